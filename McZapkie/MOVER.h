@@ -755,6 +755,37 @@ enum class TBrakeHandle
 	MHZ_K8P,
 	MHZ_6P
 };
+/// <summary>Concrete brake-distributor class instantiated for the vehicle; lets the hot brake calls skip virtual dispatch.</summary>
+enum class brake_valve_model
+{
+	basic,
+	west,
+	ke,
+	nest3,
+	lst,
+	ested,
+	estep2,
+	estep1,
+	cv1,
+	cv1l_tr
+};
+/// <summary>Concrete driver's brake-handle class instantiated for the vehicle.</summary>
+enum class brake_handle_model
+{
+	basic,
+	fv4am,
+	mhz_en57,
+	fvel6,
+	fve408,
+	test,
+	m394,
+	h14k1,
+	st113,
+	mhz_k5p,
+	mhz_6p,
+	fd1,
+	h1405
+};
 /// <summary>Type of the auxiliary (independent) brake.</summary>
 enum class TLocalBrake
 {
@@ -1038,6 +1069,34 @@ struct TPowerParameters
 	}
 };
 
+// fixed-size table of vehicle type data. copies of the table share its content, until one of them is modified
+template <typename Type_, std::size_t Size_> class shared_table
+{
+  public:
+	shared_table() : m_data(std::make_shared<std::array<Type_, Size_>>()) {}
+	// read-only access
+	Type_ const &operator[](std::size_t const Index) const
+	{
+		return (*m_data)[Index];
+	}
+	// write access, detaching the table from its other owners if needed
+	Type_ &edit(std::size_t const Index)
+	{
+		if (m_data.use_count() > 1)
+		{
+			m_data = std::make_shared<std::array<Type_, Size_>>(*m_data);
+		}
+		return (*m_data)[Index];
+	}
+	static constexpr std::size_t size()
+	{
+		return Size_;
+	}
+
+  private:
+	std::shared_ptr<std::array<Type_, Size_>> m_data;
+};
+
 /*dla lokomotyw elektrycznych:*/
 struct TScheme
 {
@@ -1048,7 +1107,7 @@ struct TScheme
 	bool AutoSwitch = false; /*czy dana pozycja nastawniana jest recznie czy autom.*/
 	int ScndAct = 0; /*jesli ma bocznik w nastawniku, to ktory bocznik na ktorej pozycji*/
 };
-typedef TScheme TSchemeTable[ResArraySize + 1]; /*tablica rezystorow rozr.*/
+typedef shared_table<TScheme, ResArraySize + 1> TSchemeTable; /*tablica rezystorow rozr.*/
 struct TDEScheme
 {
 	double RPM = 0.0; /*obroty diesla*/
@@ -1056,13 +1115,13 @@ struct TDEScheme
 	double Umax = 0.0; /*napiecie maksymalne*/
 	double Imax = 0.0; /*prad maksymalny*/
 };
-typedef TDEScheme TDESchemeTable[33]; /*tablica WWList dla silnikow spalinowych*/
+typedef shared_table<TDEScheme, 33> TDESchemeTable; /*tablica WWList dla silnikow spalinowych*/
 struct TFFScheme
 {
 	double v = 0.0; // parametr wejsciowy
 	double freq = 0.0; // wyjscie: czestotliwosc falownika
 };
-typedef TFFScheme TFFSchemeTable[33];
+typedef shared_table<TFFScheme, 33> TFFSchemeTable;
 
 struct TWiperScheme
 {
@@ -1071,7 +1130,7 @@ struct TWiperScheme
 	double interval = 0.0; // interwal pracy wycieraczki
 	double outBackDelay = 0.0; // czas po jakim wycieraczka zacznie wracac z konca do poczatku
 };
-typedef TWiperScheme TWiperSchemeTable[16];
+typedef shared_table<TWiperScheme, 16> TWiperSchemeTable;
 
 struct TShuntScheme
 {
@@ -1080,13 +1139,13 @@ struct TShuntScheme
 	double Pmin = 0.0;
 	double Pmax = 0.0;
 };
-typedef TShuntScheme TShuntSchemeTable[33];
+typedef shared_table<TShuntScheme, 33> TShuntSchemeTable;
 struct TMPTRelay
 { /*lista przekaznikow bocznikowania*/
 	double Iup = 0.0;
 	double Idown = 0.0;
 };
-typedef TMPTRelay TMPTRelayTable[8];
+typedef shared_table<TMPTRelay, 8> TMPTRelayTable;
 
 struct TMotorParameters
 {
@@ -1557,6 +1616,31 @@ class TMoverParameters
 	};
 
   public:
+	// state updated on every physics sub-step, kept together at the front of the object so the integrator
+	// touches few cache lines per vehicle instead of fetching values scattered across the whole structure
+	TLocation Loc{0.0, 0.0, 0.0}; // pozycja pojazdów do wyznaczenia odległości pomiędzy sprzęgami
+	TRotation Rot{0.0, 0.0, 0.0};
+	double V = 0.0; // predkosc w [m/s] względem sprzęgów (dodania gdy jedzie w stronę 0)
+	double Vel = 0.0; // moduł prędkości w [km/h], używany przez AI
+	double AccS = 0.0; // efektywne przyspieszenie styczne w [m/s^2] (wszystkie siły)
+	double AccSVBased{}; // tangential acceleration calculated from velocity change
+	double AccN = 0.0; // przyspieszenie normalne w [m/s^2]
+	double AccVert = 0.0; // vertical acceleration
+	double dL = 0.0;
+	double Fb = 0.0;
+	double Ff = 0.0; /*przesuniecie, sila hamowania i tarcia*/
+	double FTrain = 0.0;
+	double FStand = 0.0; /*! sila pociagowa i oporow ruchu*/
+	double FTotal = 0.0; /*! calkowita sila dzialajaca na pojazd*/
+	double nrot = 0.0; // predkosc obrotowa kol (obrotow na sekunde)
+	double nrot_eps = 0.0; // przyspieszenie kątowe kół (bez kierunku)
+	double DistCounter = 0.0; /*! licznik kilometrow */
+	double TotalMass = 0.0; /*wyliczane przez ComputeMass*/
+	double TotalMassxg = 0.0; /*TotalMass*g*/
+	int DamageFlag = 0; // kombinacja bitowa stalych dtrain_* }
+	bool PhysicActivation = true;
+	bool IsPassive{false}; // vehicle without engine and power devices, uses reduced movement computation
+
 	std::string chkPath;
 	bool reload_FIZ();
 	double dMoveLen = 0.0;
@@ -1577,7 +1661,6 @@ class TMoverParameters
 	double Mass = 0.0;
 	double Power = 0.0; /*max. predkosc kontrukcyjna, masa wlasna, moc*/
 	double Mred = 0.0; /*Ra: zredukowane masy wirujące; potrzebne do obliczeń hamowania*/
-	double TotalMass = 0.0; /*wyliczane przez ComputeMass*/
 	double HeatingPower = 0.0;
 	double EngineHeatingRPM{0.0}; // guaranteed engine revolutions with heating enabled
 	double LightPower = 0.0; /*moc pobierana na ogrzewanie/oswietlenie*/
@@ -1620,6 +1703,9 @@ class TMoverParameters
 	std::shared_ptr<TBrake> Hamulec;
 	std::shared_ptr<TDriverHandle> Handle;
 	std::shared_ptr<TDriverHandle> LocHandle;
+	brake_valve_model HamulecModel = brake_valve_model::basic; // klasa utworzonego zaworu rozrzadczego
+	brake_handle_model HandleModel = brake_handle_model::basic; // klasa utworzonego zaworu maszynisty
+	brake_handle_model LocHandleModel = brake_handle_model::basic; // klasa utworzonego zaworu hamulca pomocniczego
 	std::shared_ptr<TReservoir> Pipe;
 	std::shared_ptr<TReservoir> Pipe2;
 	spring_brake SpringBrake;
@@ -1726,7 +1812,7 @@ class TMoverParameters
 	/*-sekcja parametrow dla lokomotywy elektrycznej*/
 	TSchemeTable RList; /*lista rezystorow rozruchowych i polaczen silnikow, dla dizla: napelnienia*/
 	int RlistSize = 0;
-	TMotorParameters MotorParam[MotorParametersArraySize + 1];
+	shared_table<TMotorParameters, MotorParametersArraySize + 1> MotorParam;
 	/*rozne parametry silnika przy bocznikowaniach*/
 	/*dla lokomotywy spalinowej z przekladnia mechaniczna: przelozenia biegow*/
 	TTransmision Transmision;
@@ -1935,8 +2021,6 @@ class TMoverParameters
 	double SpeedCtrlValue = 0; /*wybrana predkosc jazdy na tempomacie*/
 	/*--sekcja zmiennych*/
 	/*--opis konkretnego egzemplarza taboru*/
-	TLocation Loc{0.0, 0.0, 0.0}; // pozycja pojazdów do wyznaczenia odległości pomiędzy sprzęgami
-	TRotation Rot{0.0, 0.0, 0.0};
 	glm::vec3 Front{};
 	std::string Name; /*nazwa wlasna*/
 	TCoupling Couplers[2]; // urzadzenia zderzno-sprzegowe, polaczenia miedzy wagonami
@@ -1947,26 +2031,10 @@ class TMoverParameters
 	bool EventFlag = false; /*!o true jesli cos nietypowego sie wydarzy*/
 	int SoundFlag = 0; /*!o patrz stale sound_ */
 	int AIFlag{0}; // HACK: events of interest for consist owner
-	double DistCounter = 0.0; /*! licznik kilometrow */
 	std::pair<double, double> EnergyMeter; // energy <drawn, returned> from grid [kWh]
-	double V = 0.0; // predkosc w [m/s] względem sprzęgów (dodania gdy jedzie w stronę 0)
-	double Vel = 0.0; // moduł prędkości w [km/h], używany przez AI
-	double AccS = 0.0; // efektywne przyspieszenie styczne w [m/s^2] (wszystkie siły)
-	double AccSVBased{}; // tangential acceleration calculated from velocity change
-	double AccN = 0.0; // przyspieszenie normalne w [m/s^2]
-	double AccVert = 0.0; // vertical acceleration
-	double nrot = 0.0; // predkosc obrotowa kol (obrotow na sekunde)
-	double nrot_eps = 0.0; // przyspieszenie kątowe kół (bez kierunku)
 	double WheelFlat = 0.0;
 	bool TruckHunting{true}; // enable/disable truck hunting calculation
-	/*! rotacja kol [obr/s]*/
 	double EnginePower = 0.0; /*! chwilowa moc silnikow*/
-	double dL = 0.0;
-	double Fb = 0.0;
-	double Ff = 0.0; /*przesuniecie, sila hamowania i tarcia*/
-	double FTrain = 0.0;
-	double FStand = 0.0; /*! sila pociagowa i oporow ruchu*/
-	double FTotal = 0.0; /*! calkowita sila dzialajaca na pojazd*/
 	double UnitBrakeForce = 0.0; /*!s siła hamowania przypadająca na jeden element*/
 	double Ntotal = 0.0; /*!s siła nacisku klockow*/
 	bool SlippingWheels = false;
@@ -2054,7 +2122,6 @@ class TMoverParameters
 	double LimPipePress = 0.0; /*stabilizator cisnienia*/
 	double ActFlowSpeed = 0.0; /*szybkosc stabilizatora*/
 
-	int DamageFlag = 0; // kombinacja bitowa stalych dtrain_* }
 	int EngDmgFlag = 0; // kombinacja bitowa stalych usterek}
 
 	// EndSignalsFlag: byte;  {ABu 060205: zmiany - koncowki: 1/16 - swiatla prz/tyl, 2/31 - blachy prz/tyl}
@@ -2231,13 +2298,11 @@ class TMoverParameters
 	int DoubleTr = 1; // trakcja ukrotniona - przedni pojazd 'Winger 160304
 	basic_light CompartmentLights;
 
-	bool PhysicActivation = true;
 
 	/*ABu: stale dla wyznaczania sil (i nie tylko) po optymalizacji*/
 	double FrictConst1 = 0.0;
 	double FrictConst2s = 0.0;
 	double FrictConst2d = 0.0;
-	double TotalMassxg = 0.0; /*TotalMass*g*/
 
 	double fBrakeCtrlPos = -2.0; // płynna nastawa hamulca zespolonego
 	bool bPantKurek3 = true; // kurek trójdrogowy (pantografu): true=połączenie z ZG, false=połączenie z małą sprężarką // domyślnie zbiornik pantografu połączony jest ze zbiornikiem głównym
@@ -2314,6 +2379,7 @@ class TMoverParameters
 	                       TRotation const &NewRot); // oblicza przesuniecie pojazdu
 	double FastComputeMovement(double dt, const TTrackShape &Shape, TTrackParam &Track, TLocation const &NewLoc, TRotation const &NewRot); // oblicza przesuniecie pojazdu - wersja zoptymalizowana
 	void compute_movement_(double const Deltatime);
+	void compute_devices_(double const Deltatime);
 	double ShowEngineRotation(int VehN);
 
 	// Q *******************************************************************************************
@@ -2412,6 +2478,13 @@ class TMoverParameters
 	void UpdateScndPipePressure(double dt);
 	void UpdateSpringBrake(double dt);
 	double GetDVc(double dt);
+	// effective cross-section of the main pipe between this and coupled vehicle
+	double PipeCouplingSection() const;
+	// flows of the brake valve and the driver's brake valves, resolved through the model tags instead of virtual calls
+	double BrakeValveFlow(double const Pressure, double const Deltatime);
+	double BrakeValveHighPressureFlow(double const Pressure, double const Deltatime);
+	static double BrakeHandleFlow(TDriverHandle &Valve, brake_handle_model const Model, double const Position, double const Pressure, double const Highpressure, double const Deltatime,
+	                              double const Equivalentpressure);
 
 	/*funkcje obliczajace sily*/
 	void ComputeConstans(void); // ABu: wczesniejsze wyznaczenie stalych dla liczenia sil
@@ -2532,11 +2605,13 @@ class TMoverParameters
 	bool ChangeOffsetH(double DeltaOffset);
 
 	/*funkcje ladujace pliki opisujace pojazd*/
-	bool LoadFIZ(std::string chkpath); // Q 20160717    bool LoadChkFile(std::string chkpath);
+	bool LoadFIZ(std::string chkpath, bool const Usecache = false); // Q 20160717    bool LoadChkFile(std::string chkpath);
 	bool CheckLocomotiveParameters(bool ReadyFlag, int Dir);
 	std::string EngineDescription(int what) const;
 
   private:
+	bool LoadFIZ_FromCache(std::string const &Filename);
+	void LoadFIZ_StoreInCache(std::string const &Filename, std::unordered_map<std::string, std::string> const &Fizlines) const;
 	void LoadFIZ_Param(std::string const &line);
 	void LoadFIZ_Load(std::string const &line);
 	void LoadFIZ_Dimensions(std::string const &line);
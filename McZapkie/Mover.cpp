@@ -38,6 +38,76 @@ inline double square(double val) // SQR() zle liczylo w current() ...
 	return val * val;
 }
 
+namespace
+{
+
+// calls Function_ with the brake valve cast to its concrete class, so the hot methods can be invoked
+// with qualified names and skip the virtual dispatch. the model tag is assigned when the valve is created
+template <typename Function_> auto visit_brake(brake_valve_model const Model, TBrake &Brake, Function_ &&Function) -> decltype(Function(Brake))
+{
+	switch (Model)
+	{
+	case brake_valve_model::west: return Function(static_cast<TWest &>(Brake));
+	case brake_valve_model::ke: return Function(static_cast<TKE &>(Brake));
+	case brake_valve_model::nest3: return Function(static_cast<TNESt3 &>(Brake));
+	case brake_valve_model::lst: return Function(static_cast<TLSt &>(Brake));
+	case brake_valve_model::ested: return Function(static_cast<TEStED &>(Brake));
+	case brake_valve_model::estep2: return Function(static_cast<TEStEP2 &>(Brake));
+	case brake_valve_model::estep1: return Function(static_cast<TEStEP1 &>(Brake));
+	case brake_valve_model::cv1: return Function(static_cast<TCV1 &>(Brake));
+	case brake_valve_model::cv1l_tr: return Function(static_cast<TCV1L_TR &>(Brake));
+	default: return Function(Brake);
+	}
+}
+
+// driver's brake handle counterpart of visit_brake()
+template <typename Function_> auto visit_handle(brake_handle_model const Model, TDriverHandle &Handle, Function_ &&Function) -> decltype(Function(Handle))
+{
+	switch (Model)
+	{
+	case brake_handle_model::fv4am: return Function(static_cast<TFV4aM &>(Handle));
+	case brake_handle_model::mhz_en57: return Function(static_cast<TMHZ_EN57 &>(Handle));
+	case brake_handle_model::fvel6: return Function(static_cast<TFVel6 &>(Handle));
+	case brake_handle_model::fve408: return Function(static_cast<TFVE408 &>(Handle));
+	case brake_handle_model::test: return Function(static_cast<Ttest &>(Handle));
+	case brake_handle_model::m394: return Function(static_cast<TM394 &>(Handle));
+	case brake_handle_model::h14k1: return Function(static_cast<TH14K1 &>(Handle));
+	case brake_handle_model::st113: return Function(static_cast<TSt113 &>(Handle));
+	case brake_handle_model::mhz_k5p: return Function(static_cast<TMHZ_K5P &>(Handle));
+	case brake_handle_model::mhz_6p: return Function(static_cast<TMHZ_6P &>(Handle));
+	case brake_handle_model::fd1: return Function(static_cast<TFD1 &>(Handle));
+	case brake_handle_model::h1405: return Function(static_cast<TH1405 &>(Handle));
+	default: return Function(Handle);
+	}
+}
+
+} // namespace
+
+double TMoverParameters::BrakeValveFlow(double const Pressure, double const Deltatime)
+{
+	return visit_brake(HamulecModel, *Hamulec, [&](auto &brake) {
+		using brake_type = std::decay_t<decltype(brake)>;
+		return brake.brake_type::GetPF(Pressure, Deltatime, Vel);
+	});
+}
+
+double TMoverParameters::BrakeValveHighPressureFlow(double const Pressure, double const Deltatime)
+{
+	return visit_brake(HamulecModel, *Hamulec, [&](auto &brake) {
+		using brake_type = std::decay_t<decltype(brake)>;
+		return brake.brake_type::GetHPFlow(Pressure, Deltatime);
+	});
+}
+
+double TMoverParameters::BrakeHandleFlow(TDriverHandle &Valve, brake_handle_model const Model, double const Position, double const Pressure, double const Highpressure, double const Deltatime,
+                                         double const Equivalentpressure)
+{
+	return visit_handle(Model, Valve, [&](auto &handle) {
+		using handle_type = std::decay_t<decltype(handle)>;
+		return handle.handle_type::GetPF(Position, Pressure, Highpressure, Deltatime, Equivalentpressure);
+	});
+}
+
 double ComputeCollision(double &v1, double &v2, double m1, double m2, double beta, bool vc)
 { // oblicza zmiane predkosci i przyrost pedu wskutek kolizji
 	assert(beta < 1.0);
@@ -474,15 +544,7 @@ TMoverParameters::TMoverParameters(double VelInitial, std::string TypeNameInit,
 	iLights[1] = 0; // światła zgaszone
 
 	// inicjalizacja stalych
-	for (int b = 0; b < ResArraySize + 1; ++b)
-	{
-		RList[b] = TScheme();
-	}
 	RlistSize = 0;
-	for (int b = 0; b < MotorParametersArraySize + 1; ++b)
-	{
-		MotorParam[b] = TMotorParameters();
-	}
 
 	for (int b = 0; b < 2; ++b)
 		for (int k = 0; k < 17; ++k)
@@ -1547,6 +1609,56 @@ void TMoverParameters::compute_movement_(double const Deltatime)
 
 	RunInternalCommand();
 
+	// TODO: gather and move current calculations to dedicated method
+	TotalCurrent = 0;
+
+	// vehicles without engine and power equipment don't have any of the devices, only brakes, doors and couplers
+	if (false == IsPassive)
+	{
+		compute_devices_(Deltatime);
+	}
+
+	UpdateBrakePressure(Deltatime);
+	UpdatePipePressure(Deltatime);
+	if (false == IsPassive)
+	{
+		UpdateBatteryVoltage(Deltatime);
+	}
+	UpdateScndPipePressure(Deltatime); // druga rurka, youBy
+
+	if ((DCEMUED_CC & 1) != 0 && (Couplers[end::front].CouplingFlag & coupling::control) != 0)
+	{
+		DynamicBrakeEMUStatus &= Couplers[end::front].Connected->DynamicBrakeEMUStatus;
+	}
+	if ((DCEMUED_CC & 2) != 0 && (Couplers[end::rear].CouplingFlag & coupling::control) != 0)
+	{
+		DynamicBrakeEMUStatus &= Couplers[end::rear].Connected->DynamicBrakeEMUStatus;
+	}
+
+	if (BrakeSlippingTimer > 0.8 && ASBType != 128)
+	{ // ASBSpeed=0.8
+		// hamulec antypoślizgowy - wyłączanie
+		Hamulec->ASB(0);
+	}
+	BrakeSlippingTimer += Deltatime;
+	// automatic doors
+	update_doors(Deltatime);
+
+	m_plc.update(Deltatime);
+
+	PowerCouplersCheck(Deltatime, coupling::highvoltage);
+	PowerCouplersCheck(Deltatime, coupling::power110v);
+	PowerCouplersCheck(Deltatime, coupling::power24v);
+
+	Power24vVoltage = std::max(PowerCircuits[0].first, GetTrainsetVoltage(coupling::power24v));
+	Power24vIsAvailable = Power24vVoltage > 0;
+	Power110vIsAvailable = PowerCircuits[1].first > 0 || GetTrainsetVoltage(coupling::power110v) > 0;
+}
+
+// updates of engine, power and auxiliary devices, done as part of movement computation
+void TMoverParameters::compute_devices_(double const Deltatime)
+{
+
 	// relay settings
 	if (EngineType == TEngineType::ElectricSeriesMotor)
 	{
@@ -1605,9 +1717,6 @@ void TMoverParameters::compute_movement_(double const Deltatime)
 		}
 	}
 
-	// TODO: gather and move current calculations to dedicated method
-	TotalCurrent = 0;
-
 	// low voltage power sources
 	LowVoltagePowerCheck(Deltatime);
 	// power sources
@@ -1639,39 +1748,6 @@ void TMoverParameters::compute_movement_(double const Deltatime)
 	HeatingCheck(Deltatime);
 	// lighting
 	LightsCheck(Deltatime);
-
-	UpdateBrakePressure(Deltatime);
-	UpdatePipePressure(Deltatime);
-	UpdateBatteryVoltage(Deltatime);
-	UpdateScndPipePressure(Deltatime); // druga rurka, youBy
-
-	if ((DCEMUED_CC & 1) != 0 && (Couplers[end::front].CouplingFlag & coupling::control) != 0)
-	{
-		DynamicBrakeEMUStatus &= Couplers[end::front].Connected->DynamicBrakeEMUStatus;
-	}
-	if ((DCEMUED_CC & 2) != 0 && (Couplers[end::rear].CouplingFlag & coupling::control) != 0)
-	{
-		DynamicBrakeEMUStatus &= Couplers[end::rear].Connected->DynamicBrakeEMUStatus;
-	}
-
-	if (BrakeSlippingTimer > 0.8 && ASBType != 128)
-	{ // ASBSpeed=0.8
-		// hamulec antypoślizgowy - wyłączanie
-		Hamulec->ASB(0);
-	}
-	BrakeSlippingTimer += Deltatime;
-	// automatic doors
-	update_doors(Deltatime);
-
-	m_plc.update(Deltatime);
-
-	PowerCouplersCheck(Deltatime, coupling::highvoltage);
-	PowerCouplersCheck(Deltatime, coupling::power110v);
-	PowerCouplersCheck(Deltatime, coupling::power24v);
-
-	Power24vVoltage = std::max(PowerCircuits[0].first, GetTrainsetVoltage(coupling::power24v));
-	Power24vIsAvailable = Power24vVoltage > 0;
-	Power110vIsAvailable = PowerCircuits[1].first > 0 || GetTrainsetVoltage(coupling::power110v) > 0;
 }
 
 void TMoverParameters::MainsCheck(double const Deltatime)
@@ -4506,7 +4582,7 @@ void TMoverParameters::UpdatePipePressure(double dt)
 			{
 				lbpa = std::max(lbpa, StopBrakeDecc);
 			}
-			dpLocalValve = LocHandle->GetPF(std::max(lbpa, LocalBrakePosAEIM), Hamulec->GetBCP(), ScndPipePress, dt, 0);
+			dpLocalValve = BrakeHandleFlow(*LocHandle, LocHandleModel, std::max(lbpa, LocalBrakePosAEIM), Hamulec->GetBCP(), ScndPipePress, dt, 0);
 		}
 		else
 		{
@@ -4514,7 +4590,7 @@ void TMoverParameters::UpdatePipePressure(double dt)
 			// (LocalBrakePosAEIM). When SplitEDPneumaticBrake is active the dedicated LocalBrake
 			// lever should apply pneumatic pressure on the locomotive directly, bypassing MED.
 			double lbpa = SplitEDPneumaticBrake ? LocalBrakePosA : 0.0;
-			dpLocalValve = LocHandle->GetPF(std::max(lbpa, LocalBrakePosAEIM), Hamulec->GetBCP(), ScndPipePress, dt, 0);
+			dpLocalValve = BrakeHandleFlow(*LocHandle, LocHandleModel, std::max(lbpa, LocalBrakePosAEIM), Hamulec->GetBCP(), ScndPipePress, dt, 0);
 		}
 
 		LockPipe = PipePress < (LockPipe ? LockPipeOff : LockPipeOn);
@@ -4546,16 +4622,16 @@ void TMoverParameters::UpdatePipePressure(double dt)
 					if (SpeedCtrlUnit.BrakeInterventionUnbraking)
 						pos = Handle->GetPos(bh_RP);
 				}
-				dpMainValve = Handle->GetPF(pos, PipePress, temp, dt, EqvtPipePress);
+				dpMainValve = BrakeHandleFlow(*Handle, HandleModel, pos, PipePress, temp, dt, EqvtPipePress);
 			}
 			else
 			{
-				dpMainValve = Handle->GetPF(0, PipePress, temp, dt, EqvtPipePress);
+				dpMainValve = BrakeHandleFlow(*Handle, HandleModel, 0, PipePress, temp, dt, EqvtPipePress);
 			}
 		}
 		else if (BrakeCtrlPos == Handle->GetPos(bh_EB))
 		{
-			dpMainValve = Handle->GetPF(BrakeCtrlPosR, PipePress, temp, dt, EqvtPipePress);
+			dpMainValve = BrakeHandleFlow(*Handle, HandleModel, BrakeCtrlPosR, PipePress, temp, dt, EqvtPipePress);
 		}
 
 		if (dpMainValve < 0) // && (PipePressureVal > 0.01)           //50
@@ -4731,7 +4807,8 @@ void TMoverParameters::UpdatePipePressure(double dt)
 		temp = 0.0; // odetnij
 	else
 		temp = 1.0; // połącz
-	Pipe->Flow(temp * Hamulec->GetPF(temp * PipePress, dt, Vel) + GetDVc(dt));
+	// with the consist-level solver enabled the exchange with coupled vehicles was already calculated for this step
+	Pipe->Flow(temp * BrakeValveFlow(temp * PipePress, dt) + (Global.BrakePipeSolver ? 0.0 : GetDVc(dt)));
 
 	if (ASBType == 128)
 		Hamulec->ASB(int(SlippingWheels && Vel > 1) * (1 + 2 * int(nrot_eps < -0.01)));
@@ -4804,7 +4881,7 @@ void TMoverParameters::UpdateScndPipePressure(double dt)
 			Couplers[1].Connected->Pipe2->Flow(-dV);
 		}
 
-	Pipe2->Flow(Hamulec->GetHPFlow(ScndPipePress, dt));
+	Pipe2->Flow(BrakeValveHighPressureFlow(ScndPipePress, dt));
 	// NOTE: condition disabled to allow the air flow from the main hose to the main tank as well
 	if (/* ( ( Compressor > ScndPipePress ) && ( */ VeselVolume > 0.0 /* ) ) || ( TrainType == dt_EZT ) || ( TrainType == dt_DMU ) */)
 	{
@@ -4871,7 +4948,7 @@ double TMoverParameters::GetDVc(double dt)
 		if (TestFlag(Couplers[0].CouplingFlag, ctrain_pneumatic))
 		{ //*0.85
 			c = Couplers[0].Connected; // skrot           //0.08           //e/D * L/D = e/D^2 * L
-			dv1 = 0.5 * dt * PF(PipePress, c->PipePress, Spg / (1.0 + 0.015 / Spg * Dim.L));
+			dv1 = 0.5 * dt * PF(PipePress, c->PipePress, PipeCouplingSection());
 			if (dv1 * dv1 > 0.00000000000001)
 				c->switch_physics(true);
 			c->Pipe->Flow(-dv1);
@@ -4881,7 +4958,7 @@ double TMoverParameters::GetDVc(double dt)
 		if (TestFlag(Couplers[1].CouplingFlag, ctrain_pneumatic))
 		{
 			c = Couplers[1].Connected; // skrot
-			dv2 = 0.5 * dt * PF(PipePress, c->PipePress, Spg / (1.0 + 0.015 / Spg * Dim.L));
+			dv2 = 0.5 * dt * PF(PipePress, c->PipePress, PipeCouplingSection());
 			if (dv2 * dv2 > 0.00000000000001)
 				c->switch_physics(true);
 			c->Pipe->Flow(-dv2);
@@ -4900,6 +4977,13 @@ double TMoverParameters::GetDVc(double dt)
 	return dv2 + dv1;
 }
 
+// effective cross-section of the main pipe between this and coupled vehicle
+double TMoverParameters::PipeCouplingSection() const
+{
+	//*0.85                //0.08           //e/D * L/D = e/D^2 * L
+	return Spg / (1.0 + 0.015 / Spg * Dim.L);
+}
+
 // *************************************************************************************************
 // Q: 20160713
 // Obliczenie stałych potrzebnych do dalszych obliczeń
@@ -6490,7 +6574,7 @@ double TMoverParameters::TractionForce(double dt)
 				// power inverters
 				auto const tmpV{std::abs(eimv[eimv_fp])};
 				auto const useFFEDList = FFEDListSize > 0 && DynamicBrakeFlag;
-				auto const list = useFFEDList ? FFEDlist : FFlist;
+				auto const &list = useFFEDList ? FFEDlist : FFlist;
 				auto const listSize = useFFEDList ? FFEDListSize : FFListSize;
 
 				if (listSize > 0 && std::abs(eimv[eimv_If]) > 1.0 && tmpV > 0.0001)
@@ -6943,7 +7027,7 @@ bool TMoverParameters::AutoRelayCheck(void)
 					}
 				}
 				// main bez samoczynnego rozruchu
-				if (MainCtrlActualPos < sizeof(RList) / sizeof(TScheme) - 1 // crude guard against running out of current fixed table
+				if (MainCtrlActualPos < RList.size() - 1 // crude guard against running out of current fixed table
 				    && (RList[MainCtrlActualPos].Relay < MainCtrlPos || (RList[MainCtrlActualPos + 1].Relay == MainCtrlPos && MainCtrlActualPos < RlistSize) ||
 				        (TrainType == dt_ET22 && DelayCtrlFlag)))
 				{
@@ -9078,16 +9162,17 @@ bool TMoverParameters::readMPT0(std::string const &line)
 	}
 	int idx = 0; // numer pozycji
 	parser >> idx;
+	auto &motorparam{MotorParam.edit(idx)};
 	switch (EngineType)
 	{
 	case TEngineType::DieselEngine:
 	{
-		parser >> MotorParam[idx].mIsat >> MotorParam[idx].fi0 >> MotorParam[idx].fi >> MotorParam[idx].mfi0 >> MotorParam[idx].mfi >> MotorParam[idx].Isat;
+		parser >> motorparam.mIsat >> motorparam.fi0 >> motorparam.fi >> motorparam.mfi0 >> motorparam.mfi >> motorparam.Isat;
 		break;
 	}
 	default:
 	{
-		parser >> MotorParam[idx].mfi >> MotorParam[idx].mIsat >> MotorParam[idx].mfi0 >> MotorParam[idx].fi >> MotorParam[idx].Isat >> MotorParam[idx].fi0;
+		parser >> motorparam.mfi >> motorparam.mIsat >> motorparam.mfi0 >> motorparam.fi >> motorparam.Isat >> motorparam.fi0;
 		break;
 	}
 	}
@@ -9095,11 +9180,11 @@ bool TMoverParameters::readMPT0(std::string const &line)
 	{
 		int autoswitch;
 		parser >> autoswitch;
-		MotorParam[idx].AutoSwitch = autoswitch == 1;
+		motorparam.AutoSwitch = autoswitch == 1;
 	}
 	else
 	{
-		MotorParam[idx].AutoSwitch = false;
+		motorparam.AutoSwitch = false;
 	}
 	return true;
 }
@@ -9142,16 +9227,17 @@ bool TMoverParameters::readMPTElectricSeries(std::string const &line)
 	}
 	int idx = 0; // numer pozycji
 	parser >> idx;
-	parser >> MotorParam[idx].mfi >> MotorParam[idx].mIsat >> MotorParam[idx].fi >> MotorParam[idx].Isat;
+	auto &motorparam{MotorParam.edit(idx)};
+	parser >> motorparam.mfi >> motorparam.mIsat >> motorparam.fi >> motorparam.Isat;
 	if (true == parser.getTokens(1, false))
 	{
 		int autoswitch;
 		parser >> autoswitch;
-		MotorParam[idx].AutoSwitch = autoswitch == 1;
+		motorparam.AutoSwitch = autoswitch == 1;
 	}
 	else
 	{
-		MotorParam[idx].AutoSwitch = false;
+		motorparam.AutoSwitch = false;
 	}
 	return true;
 }
@@ -9167,7 +9253,9 @@ bool TMoverParameters::readMPTDieselElectric(std::string const &line)
 	}
 	int idx = 0; // numer pozycji
 	parser >> idx;
-	parser >> MotorParam[idx].mfi >> MotorParam[idx].mIsat >> MotorParam[idx].fi >> MotorParam[idx].Isat >> MPTRelay[idx].Iup >> MPTRelay[idx].Idown;
+	auto &motorparam{MotorParam.edit(idx)};
+	auto &relay{MPTRelay.edit(idx)};
+	parser >> motorparam.mfi >> motorparam.mIsat >> motorparam.fi >> motorparam.Isat >> relay.Iup >> relay.Idown;
 
 	return true;
 }
@@ -9183,16 +9271,17 @@ bool TMoverParameters::readMPTDieselEngine(std::string const &line)
 	}
 	int idx = 0; // numer pozycji
 	parser >> idx;
-	parser >> MotorParam[idx].mIsat >> MotorParam[idx].fi >> MotorParam[idx].mfi;
+	auto &motorparam{MotorParam.edit(idx)};
+	parser >> motorparam.mIsat >> motorparam.fi >> motorparam.mfi;
 	if (true == parser.getTokens(1, false))
 	{
 		int autoswitch;
 		parser >> autoswitch;
-		MotorParam[idx].AutoSwitch = autoswitch == 1;
+		motorparam.AutoSwitch = autoswitch == 1;
 	}
 	else
 	{
-		MotorParam[idx].AutoSwitch = false;
+		motorparam.AutoSwitch = false;
 	}
 	return true;
 }
@@ -9239,20 +9328,21 @@ bool TMoverParameters::readRList(std::string const &Input)
 		return false;
 	}
 	auto idx = LISTLINE++;
-	if (idx >= sizeof(RList) / sizeof(TScheme))
+	if (idx >= RList.size())
 	{
 		WriteLog("Read RList: number of entries exceeded capacity of the data table");
 		return false;
 	}
-	parser >> RList[idx].Relay >> RList[idx].R >> RList[idx].Bn >> RList[idx].Mn >> RList[idx].AutoSwitch;
+	auto &scheme{RList.edit(idx)};
+	parser >> scheme.Relay >> scheme.R >> scheme.Bn >> scheme.Mn >> scheme.AutoSwitch;
 
 	if (true == parser.getTokens(1, false))
 	{
-		parser >> RList[idx].ScndAct;
+		parser >> scheme.ScndAct;
 	}
 	else
 	{
-		RList[idx].ScndAct = 0;
+		scheme.ScndAct = 0;
 	}
 
 	return true;
@@ -9282,12 +9372,13 @@ bool TMoverParameters::readDList(std::string const &line)
 	cParser parser(line);
 	parser.getTokens(3, false);
 	auto idx = LISTLINE++;
-	if (idx >= sizeof(RList) / sizeof(TScheme))
+	if (idx >= RList.size())
 	{
 		WriteLog("Read DList: number of entries exceeded capacity of the data table");
 		return false;
 	}
-	parser >> RList[idx].Relay >> RList[idx].R >> RList[idx].Mn;
+	auto &scheme{RList.edit(idx)};
+	parser >> scheme.Relay >> scheme.R >> scheme.Mn;
 
 	return true;
 }
@@ -9382,12 +9473,13 @@ bool TMoverParameters::readFFList(std::string const &line)
 		return false;
 	}
 	int idx = LISTLINE++;
-	if (idx >= sizeof(FFlist) / sizeof(TFFScheme))
+	if (idx >= FFlist.size())
 	{
 		WriteLog("Read FList: number of entries exceeded capacity of the data table");
 		return false;
 	}
-	parser >> FFlist[idx].v >> FFlist[idx].freq;
+	auto &scheme{FFlist.edit(idx)};
+	parser >> scheme.v >> scheme.freq;
 
 	return true;
 }
@@ -9402,12 +9494,13 @@ bool TMoverParameters::readFFEDList(std::string const &line)
 		return false;
 	}
 	int idx = LISTLINE++;
-	if (idx >= sizeof(FFEDlist) / sizeof(TFFScheme))
+	if (idx >= FFEDlist.size())
 	{
 		WriteLog("Read FList: number of entries exceeded capacity of the data table");
 		return false;
 	}
-	parser >> FFEDlist[idx].v >> FFEDlist[idx].freq;
+	auto &scheme{FFEDlist.edit(idx)};
+	parser >> scheme.v >> scheme.freq;
 
 	return true;
 }
@@ -9422,12 +9515,13 @@ bool TMoverParameters::readWiperList(std::string const &line)
 		return false;
 	}
 	int idx = LISTLINE++;
-	if (idx >= sizeof(WiperList) / sizeof(TWiperScheme))
+	if (idx >= WiperList.size())
 	{
 		WriteLog("Read WiperList: number of entries exceeded capacity of the data table");
 		return false;
 	}
-	parser >> WiperList[idx].byteSum >> WiperList[idx].WiperSpeed >> WiperList[idx].interval >> WiperList[idx].outBackDelay;
+	auto &scheme{WiperList.edit(idx)};
+	parser >> scheme.byteSum >> scheme.WiperSpeed >> scheme.interval >> scheme.outBackDelay;
 	return true;
 }
 
@@ -9458,20 +9552,22 @@ bool TMoverParameters::readWWList(std::string const &line)
 		return false;
 	}
 	int idx = LISTLINE++;
-	if (idx >= sizeof(DElist) / sizeof(TDEScheme))
+	if (idx >= DElist.size())
 	{
 		WriteLog("Read WWList: number of entries exceeded capacity of the data table");
 		return false;
 	}
-	parser >> DElist[idx].RPM >> DElist[idx].GenPower >> DElist[idx].Umax >> DElist[idx].Imax;
+	auto &scheme{DElist.edit(idx)};
+	parser >> scheme.RPM >> scheme.GenPower >> scheme.Umax >> scheme.Imax;
 
 	if (true == parser.getTokens(3, false))
 	{
 		// optional parameters for shunt mode
-		parser >> SST[idx].Umin >> SST[idx].Umax >> SST[idx].Pmax;
+		auto &shuntscheme{SST.edit(idx)};
+		parser >> shuntscheme.Umin >> shuntscheme.Umax >> shuntscheme.Pmax;
 
-		SST[idx].Pmin = std::sqrt(std::pow(SST[idx].Umin, 2) / 47.6);
-		SST[idx].Pmax = std::min(SST[idx].Pmax, std::pow(SST[idx].Umax, 2) / 47.6);
+		shuntscheme.Pmin = std::sqrt(std::pow(shuntscheme.Umin, 2) / 47.6);
+		shuntscheme.Pmax = std::min(shuntscheme.Pmax, std::pow(shuntscheme.Umax, 2) / 47.6);
 	}
 	return true;
 }
@@ -9602,7 +9698,122 @@ void TMoverParameters::BrakeSubsystemDecode()
 // TDynamicObject::Init()
 // Po niej wykonywana jest CreateBrakeSys(), ktora jest odpowiednikiem CheckLocomotiveParameters()
 // *************************************************************************************************
-bool TMoverParameters::LoadFIZ(std::string chkpath)
+namespace
+{
+// parsed vehicle definition, shared by all vehicles of the same type
+struct fiz_cache_entry
+{
+	std::filesystem::file_time_type timestamp;
+	std::shared_ptr<TMoverParameters const> prototype; // vehicle state right after parsing of the definition file
+	bool randompipepressure{false}; // control pipe pressure wasn't specified and received random variation
+	bool lowpipepressure{false}; // low pipe pressure was specified explicitly
+};
+
+std::mutex FizCacheLock;
+std::unordered_map<std::string, fiz_cache_entry> FizCache;
+} // namespace
+
+// initializes vehicle parameters from previously parsed definition file. returns: true if the cached definition was available
+bool TMoverParameters::LoadFIZ_FromCache(std::string const &Filename)
+{
+	std::error_code error;
+	auto const timestamp{std::filesystem::last_write_time(Filename, error)};
+	if (error)
+	{
+		return false;
+	}
+
+	fiz_cache_entry entry;
+	{
+		std::lock_guard<std::mutex> lock(FizCacheLock);
+		auto const lookup{FizCache.find(Filename)};
+		if ((lookup == FizCache.end()) || (lookup->second.timestamp != timestamp))
+		{
+			return false;
+		}
+		entry = lookup->second;
+	}
+
+	auto const &prototype{*entry.prototype};
+	// preserve instance-specific data assigned on construction
+	auto name{std::move(Name)};
+	auto const caboccupied{CabOccupied};
+	auto const velocity{Vel};
+	auto const speed{V};
+	auto const path{chkPath};
+
+	*this = prototype;
+
+	Name = std::move(name);
+	CabOccupied = caboccupied;
+	Vel = velocity;
+	V = speed;
+	chkPath = path;
+	// objects owned by the vehicle can't be shared with the prototype...
+	if (SpringBrake.Cylinder)
+	{
+		SpringBrake.Cylinder = std::make_shared<TReservoir>(*SpringBrake.Cylinder);
+	}
+	// ...and links to own data have to point at this vehicle
+	for (auto *powersource : {&EnginePowerSource, &SystemPowerSource, &HeatingPowerSource, &AlterHeatPowerSource, &LightPowerSource, &AlterLightPowerSource})
+	{
+		if ((powersource->SourceType == TPowerSource::Generator) && (powersource->EngineGenerator.engine_revolutions == &prototype.enrot))
+		{
+			powersource->EngineGenerator.engine_revolutions = &enrot;
+		}
+	}
+	if (entry.randompipepressure)
+	{
+		// replicate individual inaccuracy of the default control pipe pressure
+		CntrlPipePress = 5 + 0.001 * (Random(10) - Random(10));
+		HighPipePress = CntrlPipePress;
+		if (false == entry.lowpipepressure)
+		{
+			LowPipePress = std::min(HighPipePress, 3.5);
+		}
+		DeltaPipePress = HighPipePress - LowPipePress;
+	}
+
+	WriteLog("LOAD FIZ FROM " + Filename + " (cached)");
+	return true;
+}
+
+// stores copy of freshly parsed vehicle parameters for use by other vehicles of the same type
+void TMoverParameters::LoadFIZ_StoreInCache(std::string const &Filename, std::unordered_map<std::string, std::string> const &Fizlines) const
+{
+	std::error_code error;
+	auto const timestamp{std::filesystem::last_write_time(Filename, error)};
+	if (error)
+	{
+		return;
+	}
+
+	fiz_cache_entry entry;
+	entry.timestamp = timestamp;
+	auto prototype{std::make_shared<TMoverParameters>(*this)};
+	// links to own data in the copy still point at this vehicle, which can be deleted before the cache entry
+	for (auto *powersource : {&prototype->EnginePowerSource, &prototype->SystemPowerSource, &prototype->HeatingPowerSource, &prototype->AlterHeatPowerSource, &prototype->LightPowerSource,
+	                          &prototype->AlterLightPowerSource})
+	{
+		if ((powersource->SourceType == TPowerSource::Generator) && (powersource->EngineGenerator.engine_revolutions == &enrot))
+		{
+			powersource->EngineGenerator.engine_revolutions = &prototype->enrot;
+		}
+	}
+	entry.prototype = std::move(prototype);
+	// pipe pressures are only set up, with random variation, by the brake section of the definition
+	auto const brakeline{Fizlines.find("Brake")};
+	if (brakeline != Fizlines.end())
+	{
+		entry.randompipepressure = extract_value("HiPP", brakeline->second).empty();
+		entry.lowpipepressure = (false == extract_value("LoPP", brakeline->second).empty());
+	}
+
+	std::lock_guard<std::mutex> lock(FizCacheLock);
+	FizCache[Filename] = std::move(entry);
+}
+
+bool TMoverParameters::LoadFIZ(std::string chkpath, bool const Usecache)
 {
 	chkPath = chkpath; // assign class path for reloading
 	const int param_ok = 1;
@@ -9630,6 +9841,12 @@ bool TMoverParameters::LoadFIZ(std::string chkpath)
 	startCOMPRESSORLIST = false;
 	std::string file = TypeName + ".fiz";
 
+	if ((true == Usecache) && (true == LoadFIZ_FromCache(chkpath + file)))
+	{
+		ConversionError = 0;
+		return true;
+	}
+
 	WriteLog("LOAD FIZ FROM " + file);
 	/*
 	    std::ifstream in(file);
@@ -10237,6 +10454,11 @@ bool TMoverParameters::LoadFIZ(std::string chkpath)
 		modernDimmerPosition = modernDimmerDefaultPosition;
 	}
 
+	if ((true == Usecache) && (true == result))
+	{
+		LoadFIZ_StoreInCache(chkpath + file, fizlines);
+	}
+
 	WriteLog("CERROR: " + std::to_string(ConversionError) + ", SUCCES: " + std::to_string(result));
 	return result;
 }
@@ -11757,6 +11979,7 @@ bool TMoverParameters::CheckLocomotiveParameters(bool ReadyFlag, int Dir)
 	{
 		WriteLog("XBT W, K");
 		Hamulec = std::make_shared<TWest>(MaxBrakePress[3], BrakeCylRadius, BrakeCylDist, BrakeVVolume, BrakeCylNo, BrakeDelays, BrakeMethod, NAxles, NBpA);
+		HamulecModel = brake_valve_model::west;
 		if (MBPM < 2) // jesli przystawka wazaca
 			Hamulec->SetLP(0, MaxBrakePress[3], 0);
 		else
@@ -11767,6 +11990,7 @@ bool TMoverParameters::CheckLocomotiveParameters(bool ReadyFlag, int Dir)
 	{
 		WriteLog("XBT WKE");
 		Hamulec = std::make_shared<TKE>(MaxBrakePress[3], BrakeCylRadius, BrakeCylDist, BrakeVVolume, BrakeCylNo, BrakeDelays, BrakeMethod, NAxles, NBpA);
+		HamulecModel = brake_valve_model::ke;
 		Hamulec->SetRM(RapidMult);
 		if (MBPM < 2) // jesli przystawka wazaca
 			Hamulec->SetLP(0, MaxBrakePress[3], 0);
@@ -11781,6 +12005,7 @@ bool TMoverParameters::CheckLocomotiveParameters(bool ReadyFlag, int Dir)
 	{
 		WriteLog("XBT NESt3, ESt3, ESt3AL2, ESt4");
 		Hamulec = std::make_shared<TNESt3>(MaxBrakePress[3], BrakeCylRadius, BrakeCylDist, BrakeVVolume, BrakeCylNo, BrakeDelays, BrakeMethod, NAxles, NBpA);
+		HamulecModel = brake_valve_model::nest3;
 		static_cast<TNESt3 *>(Hamulec.get())->SetSize(BrakeValveSize, BrakeValveParams);
 		if (MBPM < 2) // jesli przystawka wazaca
 			Hamulec->SetLP(0, MaxBrakePress[3], 0);
@@ -11792,6 +12017,7 @@ bool TMoverParameters::CheckLocomotiveParameters(bool ReadyFlag, int Dir)
 	{
 		WriteLog("XBT LSt");
 		Hamulec = std::make_shared<TLSt>(MaxBrakePress[3], BrakeCylRadius, BrakeCylDist, BrakeVVolume, BrakeCylNo, BrakeDelays, BrakeMethod, NAxles, NBpA);
+		HamulecModel = brake_valve_model::lst;
 		Hamulec->SetRM(RapidMult);
 		break;
 	}
@@ -11799,6 +12025,7 @@ bool TMoverParameters::CheckLocomotiveParameters(bool ReadyFlag, int Dir)
 	{
 		WriteLog("XBT EStED");
 		Hamulec = std::make_shared<TEStED>(MaxBrakePress[3], BrakeCylRadius, BrakeCylDist, BrakeVVolume, BrakeCylNo, BrakeDelays, BrakeMethod, NAxles, NBpA);
+		HamulecModel = brake_valve_model::ested;
 		Hamulec->SetRM(RapidMult);
 		if (MBPM < 2)
 		{
@@ -11815,6 +12042,7 @@ bool TMoverParameters::CheckLocomotiveParameters(bool ReadyFlag, int Dir)
 	{
 		WriteLog("XBT EP2");
 		Hamulec = std::make_shared<TEStEP2>(MaxBrakePress[3], BrakeCylRadius, BrakeCylDist, BrakeVVolume, BrakeCylNo, BrakeDelays, BrakeMethod, NAxles, NBpA);
+		HamulecModel = brake_valve_model::estep2;
 		Hamulec->SetLP(Mass, MBPM, MaxBrakePress[1]);
 		break;
 	}
@@ -11822,6 +12050,7 @@ bool TMoverParameters::CheckLocomotiveParameters(bool ReadyFlag, int Dir)
 	{
 		WriteLog("XBT EP1");
 		Hamulec = std::make_shared<TEStEP1>(MaxBrakePress[3], BrakeCylRadius, BrakeCylDist, BrakeVVolume, BrakeCylNo, BrakeDelays, BrakeMethod, NAxles, NBpA);
+		HamulecModel = brake_valve_model::estep1;
 		Hamulec->SetLP(Mass, MBPM, MaxBrakePress[1]);
 		Hamulec->SetRM(RapidMult);
 		break;
@@ -11830,16 +12059,19 @@ bool TMoverParameters::CheckLocomotiveParameters(bool ReadyFlag, int Dir)
 	{
 		WriteLog("XBT CV1");
 		Hamulec = std::make_shared<TCV1>(MaxBrakePress[3], BrakeCylRadius, BrakeCylDist, BrakeVVolume, BrakeCylNo, BrakeDelays, BrakeMethod, NAxles, NBpA);
+		HamulecModel = brake_valve_model::cv1;
 		break;
 	}
 	case TBrakeValve::CV1_L_TR:
 	{
 		WriteLog("XBT CV1_L_T");
 		Hamulec = std::make_shared<TCV1L_TR>(MaxBrakePress[3], BrakeCylRadius, BrakeCylDist, BrakeVVolume, BrakeCylNo, BrakeDelays, BrakeMethod, NAxles, NBpA);
+		HamulecModel = brake_valve_model::cv1l_tr;
 		break;
 	}
 	default:
 		Hamulec = std::make_shared<TBrake>(MaxBrakePress[3], BrakeCylRadius, BrakeCylDist, BrakeVVolume, BrakeCylNo, BrakeDelays, BrakeMethod, NAxles, NBpA);
+		HamulecModel = brake_valve_model::basic;
 	}
 
 	Hamulec->SetASBP(MaxBrakePress[4]);
@@ -11849,37 +12081,48 @@ bool TMoverParameters::CheckLocomotiveParameters(bool ReadyFlag, int Dir)
 	{
 	case TBrakeHandle::FV4a:
 		Handle = std::make_shared<TFV4aM>();
+		HandleModel = brake_handle_model::fv4am;
 		break;
 	case TBrakeHandle::MHZ_EN57:
 	case TBrakeHandle::MHZ_K8P:
 		Handle = std::make_shared<TMHZ_EN57>();
+		HandleModel = brake_handle_model::mhz_en57;
 		break;
 	case TBrakeHandle::FVel6:
 		Handle = std::make_shared<TFVel6>();
+		HandleModel = brake_handle_model::fvel6;
 		break;
 	case TBrakeHandle::FVE408:
 		Handle = std::make_shared<TFVE408>();
+		HandleModel = brake_handle_model::fve408;
 		break;
 	case TBrakeHandle::testH:
 		Handle = std::make_shared<Ttest>();
+		HandleModel = brake_handle_model::test;
 		break;
 	case TBrakeHandle::M394:
 		Handle = std::make_shared<TM394>();
+		HandleModel = brake_handle_model::m394;
 		break;
 	case TBrakeHandle::Knorr:
 		Handle = std::make_shared<TH14K1>();
+		HandleModel = brake_handle_model::h14k1;
 		break;
 	case TBrakeHandle::St113:
 		Handle = std::make_shared<TSt113>();
+		HandleModel = brake_handle_model::st113;
 		break;
 	case TBrakeHandle::MHZ_K5P:
 		Handle = std::make_shared<TMHZ_K5P>();
+		HandleModel = brake_handle_model::mhz_k5p;
 		break;
 	case TBrakeHandle::MHZ_6P:
 		Handle = std::make_shared<TMHZ_6P>();
+		HandleModel = brake_handle_model::mhz_6p;
 		break;
 	default:
 		Handle = std::make_shared<TDriverHandle>();
+		HandleModel = brake_handle_model::basic;
 	}
 	Handle->SetParams(Handle_AutomaticOverload, Handle_ManualOverload, Handle_GenericDoubleParameter1, Handle_GenericDoubleParameter2, Handle_OverloadMaxPressure, Handle_OverloadPressureDecrease);
 
@@ -11888,6 +12131,7 @@ bool TMoverParameters::CheckLocomotiveParameters(bool ReadyFlag, int Dir)
 	case TBrakeHandle::FD1:
 	{
 		LocHandle = std::make_shared<TFD1>();
+		LocHandleModel = brake_handle_model::fd1;
 		LocHandle->Init(MaxBrakePress[0]);
 		if (TrainType == dt_EZT)
 		{
@@ -11899,11 +12143,13 @@ bool TMoverParameters::CheckLocomotiveParameters(bool ReadyFlag, int Dir)
 	case TBrakeHandle::Knorr:
 	{
 		LocHandle = std::make_shared<TH1405>();
+		LocHandleModel = brake_handle_model::h1405;
 		LocHandle->Init(MaxBrakePress[0]);
 		break;
 	}
 	default:
 		LocHandle = std::make_shared<TDriverHandle>();
+		LocHandleModel = brake_handle_model::basic;
 	}
 
 	if (true == TestFlag(BrakeDelays, bdelay_G) && (false == TestFlag(BrakeDelays, bdelay_R) || Power > 1.0)) // ustalanie srednicy przewodu glownego (lokomotywa lub napędowy
@@ -12087,6 +12333,19 @@ bool TMoverParameters::CheckLocomotiveParameters(bool ReadyFlag, int Dir)
 	}
 	SecuritySystem.MagnetLocation = std::clamp(SecuritySystem.MagnetLocation, 0.0, Dim.L);
 
+	// unpowered vehicle without own power equipment, which can't receive power or control signals from other vehicles.
+	// its devices stay idle for good, so the movement computation can skip their updates
+	auto const externalconnections{coupling::control | coupling::highvoltage | coupling::heating | coupling::power24v | coupling::power110v | coupling::power3x400v};
+	IsPassive = EngineType == TEngineType::None && Power <= 1.0 && EnginePowerSource.SourceType != TPowerSource::CurrentCollector && NominalBatteryVoltage == 0.f &&
+	            VeselVolume == 0.0 && Imaxrpc >= 0 && (Couplers[end::front].AllowedFlag & externalconnections) == 0 && (Couplers[end::rear].AllowedFlag & externalconnections) == 0;
+	if (true == IsPassive)
+	{
+		// put the skipped devices in their idle state
+		BatteryVoltage = 0.0;
+		Compressor = 0.0;
+		MainsInitTimeCountdown = MainsInitTime;
+	}
+
 	return OK;
 }
 
@@ -626,6 +626,7 @@ int eu07_application::run()
 			m_network->update();
 
 		auto const frametime{Timer::subsystem.mainloop_total.stop()};
+		profiler::frame();
 		if (Global.minframetime.count() != 0.0f && (Global.minframetime - frametime).count() > 0.0f)
 		{
 			std::this_thread::sleep_for(Global.minframetime - frametime);
@@ -681,6 +682,7 @@ void eu07_application::exit()
 	for (auto &mode : m_modes)
 		mode.reset();
 
+	audio::renderer.exit();
 	GfxRenderer->Shutdown();
 	m_network.reset();
 
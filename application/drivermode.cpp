@@ -231,6 +231,8 @@ bool driver_mode::update()
 			simulation::State.update(stepdeltatime, updatecount);
 		}
 		Timer::subsystem.sim_dynamics.stop();
+		// ai is updated along with the vehicles, its time is gathered piecewise
+		Timer::subsystem.sim_ai.commit();
 
 		// secondary fixed step simulation time routines
 		while (m_secondaryupdateaccumulator >= m_secondaryupdaterate)
@@ -285,12 +287,17 @@ bool driver_mode::update()
 		else
 			TSubModel::iInstance = 0;
 
-		if (Global.trainThreads > 0)
-			simulation::Trains.updateAsync(deltatime);
-		else
-			simulation::Trains.update(deltatime);
+		{
+			PROFILE_ZONE("trains");
+			if (Global.trainThreads > 0)
+				simulation::Trains.updateAsync(deltatime);
+			else
+				simulation::Trains.update(deltatime);
+		}
+		Timer::subsystem.sim_events.start();
 		simulation::Events.update();
 		simulation::Region->update_events();
+		Timer::subsystem.sim_events.stop();
 		simulation::Lights.update();
 	}
 
@@ -172,7 +172,7 @@ void itemproperties_panel::update(scene::basic_node *Node)
 				{
 					textline += ", ";
 				}
-				textline += event.second != nullptr ? Bezogonkow(event.second->m_name) : event.first + " (missing)";
+				textline += event.second != nullptr ? Bezogonkow(event.second->m_name) : event.first.str() + " (missing)";
 			}
 			textline += "] ";
 		}
@@ -19,6 +19,8 @@ http://mozilla.org/MPL/2.0/.
 
 namespace audio {
 
+std::mutex error_lock;
+
 openal_buffer::openal_buffer( std::string const &Filename ) :
     name( Filename ) {
 
@@ -43,6 +45,7 @@ openal_buffer::openal_buffer( std::string const &Filename ) :
 	sf_close(sf);
 
 	rate = si.samplerate;
+	length = rate > 0 ? static_cast<float>(si.frames) / rate : 0.f;
 
 	if (si.channels != 1)
 		WriteLog("sound: warning: mixing multichannel file to mono");
@@ -62,15 +65,23 @@ openal_buffer::openal_buffer( std::string const &Filename ) :
 		buf[i] = val;
 	}
 
-	alGenBuffers(1, &id);
-	if (id != null_resource && alIsBuffer(id)) {
-		alGetError();
-		alBufferData(id, AL_FORMAT_MONO16, buf, si.frames * 2, rate);
-	}
-	else {
-		id = null_resource;
-		const char *str = alGetString(alGetError());
-		ErrorLog("sound: failed to create AL buffer: " + (str != nullptr ? std::string(str) : ""));
+	{
+		std::lock_guard<std::mutex> lock(error_lock);
+		alGenBuffers(1, &id);
+		if (id != null_resource && alIsBuffer(id)) {
+			alGetError();
+			alBufferData(id, AL_FORMAT_MONO16, buf, si.frames * 2, rate);
+			ALenum const err { alGetError() };
+			if (err != AL_NO_ERROR) {
+				const char *str = alGetString(err);
+				ErrorLog("sound: failed to upload AL buffer data: " + (str != nullptr ? std::string(str) : ""));
+			}
+		}
+		else {
+			id = null_resource;
+			const char *str = alGetString(alGetError());
+			ErrorLog("sound: failed to create AL buffer: " + (str != nullptr ? std::string(str) : ""));
+		}
 	}
 
 	delete[] buf;
@@ -22,11 +22,16 @@ namespace audio {
 
 ALuint const null_resource{ ~ALuint{0} };
 
+// the implementation keeps single error state shared by all threads. calls followed by error check are made under this lock,
+// so the checks don't pick up errors caused by the other thread
+extern std::mutex error_lock;
+
 // wrapper for audio sample
 struct openal_buffer {
 // members
     ALuint id { null_resource }; // associated AL resource
     unsigned int rate {}; // sample rate of the data
+    float length {}; // playback time of the data, in seconds
     std::string name;
     std::string caption;
 // constructors
@@ -16,6 +16,7 @@ http://mozilla.org/MPL/2.0/.
 #include "utilities/Logs.h"
 #include "simulation/simulation.h"
 #include "vehicle/Train.h"
+#include "utilities/profiler.h"
 
 namespace audio {
 
@@ -24,6 +25,8 @@ bool event_volume_change { false };
 
 float const EU07_SOUND_CUTOFFRANGE { 3000.f }; // 2750 m = max expected emitter spawn range, plus safety margin
 float const EU07_SOUND_VELOCITYLIMIT { 250 / 3.6f }; // 343 m/sec ~= speed of sound; arbitrary limit of 250 km/h
+float const EU07_SOUND_VOICEFADEINTIME { 0.25f }; // seconds; gain ramp for voices resumed on implementation-side source
+float const EU07_SOUND_VOICEPRIORITYBONUS { 1.25f }; // audibility bonus for voices with a source, prevents flipping near the cutoff
 
 // potentially clamps length of provided vector to 343 meters
 // TBD: make a generic method for utilities out of this
@@ -39,30 +42,24 @@ limit_velocity( glm::vec3 const &Velocity ) {
 void
 openal_source::play() {
 
-    if( id == audio::null_resource ) { return; } // no implementation-side source to match, no point
-
-    ::alSourcePlay( id );
+    // NOTE: the implementation reports the actual state with a delay, until then we presume the playback started
+    is_playing = ( false == buffers.empty() );
+    if( id == audio::null_resource ) { return; } // virtual voice, playback is only tracked
 
-    ALint state;
-    ::alGetSourcei( id, AL_SOURCE_STATE, &state );
-    is_playing = state == AL_PLAYING;
+    request( command_type::source_play );
 }
 
 // stops the playback
 void
 openal_source::stop() {
 
-    if( id == audio::null_resource ) { return; } // no implementation-side source to match, no point
-
     loop( false );
-    // NOTE: workaround for potential edge cases where ::alSourceStop() doesn't set source which wasn't yet started to AL_STOPPED
-    int state;
-    ::alGetSourcei( id, AL_SOURCE_STATE, &state );
-    if( state == AL_INITIAL ) {
-        play();
-    }
-    ::alSourceStop( id );
+    // mark all buffers as processed, same as the implementation does
     is_playing = false;
+    sound_index = static_cast<int>( sounds.size() );
+    if( id == audio::null_resource ) { return; } // virtual voice, playback is only tracked
+
+    request( command_type::source_stop );
 }
 
 // updates state of the source
@@ -83,50 +80,91 @@ openal_source::update( double const Deltatime, glm::vec3 const &Listenervelocity
     if( id != audio::null_resource ) {
 
         sound_change = false;
-        ::alGetSourcei( id, AL_BUFFERS_PROCESSED, &sound_index );
-        // for multipart sounds trim away processed buffers until only one remains, the last one may be set to looping by the controller
-        // TBD, TODO: instead of change flag move processed buffer ids to separate queue, for accurate tracking of longer buffer sequences
-        ALuint discard;
-        while( sound_index > 0
-            && sounds.size() > 1 ) {
-            ::alSourceUnqueueBuffers( id, 1, &discard );
-            sounds.erase( std::begin( sounds ) );
-            --sound_index;
-            sound_change = true;
-            // potentially adjust starting point of the last buffer (to reduce chance of reverb effect with multiple, looping copies playing)
-            if( controller->start() > 0.f && sounds.size() == 1 ) {
-                ALint bufferid;
-                ::alGetSourcei(
-                    id,
-                    AL_BUFFER,
-                    &bufferid );
-                ALint buffersize;
-                ::alGetBufferi( bufferid, AL_SIZE, &buffersize );
-                ::alSourcei(
-                    id,
-                    AL_SAMPLE_OFFSET,
-                    static_cast<ALint>( controller->start() * ( buffersize / sizeof( std::int16_t ) ) ) );
+        // the implementation state is reported by the audio thread with a delay. until the report catches up with our last request
+        // we keep the state presumed on our end
+        auto const *report { renderer.report( id ) };
+        if( report != nullptr
+         && report->stamp == stamp ) {
+            sound_index = report->processed;
+            is_playing = report->state == AL_PLAYING;
+            playback_time = report->offset;
+            // for multipart sounds trim away processed buffers until only one remains, the last one may be set to looping by the controller
+            // TBD, TODO: instead of change flag move processed buffer ids to separate queue, for accurate tracking of longer buffer sequences
+            while( sound_index > 0
+                && sounds.size() > 1 ) {
+                request( command_type::source_unqueue, 1 );
+                sounds.erase( std::begin( sounds ) );
+                if( false == buffers.empty() ) {
+                    buffers.erase( std::begin( buffers ) );
+                    buffer_lengths.erase( std::begin( buffer_lengths ) );
+                }
+                --sound_index;
+                sound_change = true;
+                playback_time = 0.0;
+                // potentially adjust starting point of the last buffer (to reduce chance of reverb effect with multiple, looping copies playing)
+                if( controller->start() > 0.f && sounds.size() == 1 && false == buffer_lengths.empty() ) {
+                    playback_time = controller->start() * buffer_lengths.front();
+                    set( AL_SEC_OFFSET, static_cast<float>( playback_time ) );
+                }
             }
         }
 
-        int state;
-        ::alGetSourcei( id, AL_SOURCE_STATE, &state );
-        is_playing = state == AL_PLAYING;
+        if( fade < 1.f ) {
+            fade = std::min( 1.f, fade + static_cast<float>( Deltatime ) / EU07_SOUND_VOICEFADEINTIME );
+            // invalidate current gain value to enforce change of next sync
+            properties.gain = -1.f;
+        }
+    }
+    else {
+        update_virtual( Deltatime );
     }
 
     // request instructions from the controller
     controller->update( *this );
 }
 
+// advances playback of the voice without implementation-side source
+void
+openal_source::update_virtual( double const Deltatime ) {
+
+    sound_change = false;
+    if( false == is_playing ) { return; }
+
+    playback_time += Deltatime * std::clamp( properties.pitch * pitch_variation, 0.1f, 10.f );
+    // mirror behaviour of the queued buffers: processed parts of multipart sounds are trimmed away, the last one may be looping
+    while( false == buffer_lengths.empty()
+        && playback_time >= buffer_lengths.front() ) {
+
+        if( sounds.size() > 1 ) {
+            playback_time -= buffer_lengths.front();
+            sounds.erase( std::begin( sounds ) );
+            buffers.erase( std::begin( buffers ) );
+            buffer_lengths.erase( std::begin( buffer_lengths ) );
+            sound_change = true;
+            if( controller->start() > 0.f && sounds.size() == 1 ) {
+                playback_time = controller->start() * buffer_lengths.front();
+            }
+        }
+        else if( true == is_looping ) {
+            playback_time = (
+                buffer_lengths.front() > 0.f ?
+                    std::fmod( playback_time, buffer_lengths.front() ) :
+                    0.0 );
+            break;
+        }
+        else {
+            // all done, mark all buffers as processed
+            is_playing = false;
+            sound_index = static_cast<int>( sounds.size() );
+            break;
+        }
+    }
+}
+
 // configures state of the source to match the provided set of properties
 void
 openal_source::sync_with( sound_properties const &State ) {
 
-    if( id == audio::null_resource ) {
-        // no implementation-side source to match, return sync error so the controller can clean up on its end
-        sync = sync_state::bad_resource;
-        return;
-    }
     // velocity
     if( update_deltatime > 0.0
      && sound_range >= 0
@@ -134,8 +172,6 @@ openal_source::sync_with( sound_properties const &State ) {
         // after sound position was initialized we can start velocity calculations
         sound_velocity = limit_velocity( ( State.location - properties.location ) / update_deltatime );
     }
-    // NOTE: velocity at this point can be either listener velocity for global sounds, actual sound velocity, or 0 if sound position is yet unknown
-    ::alSourcefv( id, AL_VELOCITY, glm::value_ptr( sound_velocity ) );
 
     // location
     sound_distance = State.location - renderer.cached_camerapos;
@@ -146,20 +182,11 @@ openal_source::sync_with( sound_properties const &State ) {
 		                                        sound_range * 7.5f;
         if( glm::length2( sound_distance ) > std::min( sq(cutoffrange), sq(EU07_SOUND_CUTOFFRANGE) ) ) {
             stop();
+            audibility = 0.f;
             sync = sync_state::bad_distance; // flag sync failure for the controller
             return;
         }
     }
-    if( sound_range >= 0 ) {
-        // Convert dvec3 to vec3 for OpenAL
-        glm::vec3 sound_distance_float = glm::vec3(sound_distance);
-        ::alSourcefv( id, AL_POSITION, glm::value_ptr( sound_distance_float ) );
-    }
-    else {
-        // sounds with 'unlimited' or negative range are positioned on top of the listener
-        glm::vec3 zero_pos{ 0.f, 0.f, 0.f };
-        ::alSourcefv( id, AL_POSITION, glm::value_ptr( zero_pos ) );
-    }
     // gain
     auto const gain {
         State.gain
@@ -168,38 +195,61 @@ openal_source::sync_with( sound_properties const &State ) {
             State.category == sound_category::local ? Global.EnvironmentPositionalVolume :
             State.category == sound_category::ambient ? Global.EnvironmentAmbientVolume :
             1.f ) };
+    auto const referencedistance { (
+        sound_range >= 0 ?
+            sound_range :
+            5 ) // range of -1 means sound of unlimited range, positioned at the listener
+        * ( 1.f / 16.f ) * State.soundproofing };
+    auto const distancesquared { static_cast<float>( glm::length2( sound_distance ) ) };
+    auto rangefactor { 1.f };
+    if( sound_range != -1 ) {
+        // if the emitter is outside of its nominal hearing range adjust the volume to a suitable fraction of nominal value
+        auto const rangesquared { sound_range * sound_range };
+        auto const fadedistance { sound_range * 0.75f };
+        rangefactor =
+            std::lerp(
+                1.f, 0.f, std::clamp(
+                    ( distancesquared - rangesquared ) / ( fadedistance * fadedistance ),
+                    0.f, 1.f ) );
+    }
+    // estimate of the loudness at the listener, following the inverse distance clamped model used by the renderer
+    audibility = gain * rangefactor;
+    if( sound_range >= 0 && referencedistance > 0.f ) {
+        audibility *= referencedistance / ( referencedistance + 1.75f * std::max( 0.f, std::sqrt( distancesquared ) - referencedistance ) );
+    }
+
+    if( id == audio::null_resource ) {
+        // virtual voice, nothing to pass to the implementation
+        properties = State;
+        sync = sync_state::good;
+        return;
+    }
+
+    // NOTE: velocity at this point can be either listener velocity for global sounds, actual sound velocity, or 0 if sound position is yet unknown
+    set( AL_VELOCITY, sound_velocity );
+    // sounds with 'unlimited' or negative range are positioned on top of the listener
+    set( AL_POSITION, ( sound_range >= 0 ? sound_distance : glm::vec3{ 0.f } ) );
     if( State.gain != properties.gain
      || State.soundproofing_stamp != properties.soundproofing_stamp
      || audio::event_volume_change ) {
         // gain value has changed
-        ::alSourcef( id, AL_GAIN, gain );
-        auto const range { (
-            sound_range >= 0 ?
-                sound_range :
-                5 ) }; // range of -1 means sound of unlimited range, positioned at the listener
-        ::alSourcef( id, AL_REFERENCE_DISTANCE, range * ( 1.f / 16.f ) * State.soundproofing );
+        set( AL_GAIN, gain * fade );
+        set( AL_REFERENCE_DISTANCE, referencedistance );
     }
     if( sound_range != -1 ) {
         auto const rangesquared { sound_range * sound_range };
-        auto const distancesquared { static_cast<float>( glm::length2( sound_distance ) ) };
         if( distancesquared > rangesquared
          || false == is_in_range ) {
             // if the emitter is outside of its nominal hearing range or was outside of it during last check
             // adjust the volume to a suitable fraction of nominal value
-            auto const fadedistance { sound_range * 0.75f };
-            auto const rangefactor {
-                std::lerp(
-                    1.f, 0.f, std::clamp(
-                        ( distancesquared - rangesquared ) / ( fadedistance * fadedistance ),
-                        0.f, 1.f ) ) };
-            ::alSourcef( id, AL_GAIN, gain * rangefactor );
+            set( AL_GAIN, gain * fade * rangefactor );
         }
         is_in_range = distancesquared <= rangesquared;
     }
     // pitch
     if( State.pitch != properties.pitch ) {
         // pitch value has changed
-        ::alSourcef( id, AL_PITCH, std::clamp( State.pitch * pitch_variation, 0.1f, 10.f ) );
+        set( AL_PITCH, std::clamp( State.pitch * pitch_variation, 0.1f, 10.f ) );
     }
     // all synced up
     properties = State;
@@ -219,8 +269,8 @@ openal_source::range( float const Range ) {
         Range >= 0 ?
             Range :
             5 ) }; // range of -1 means sound of unlimited range, positioned at the listener
-    ::alSourcef( id, AL_REFERENCE_DISTANCE, range * ( 1.f / 16.f ) );
-    ::alSourcef( id, AL_ROLLOFF_FACTOR, 1.75f );
+    set( AL_REFERENCE_DISTANCE, range * ( 1.f / 16.f ) );
+    set( AL_ROLLOFF_FACTOR, 1.75f );
 }
 
 // sets modifier applied to the pitch of sounds emitted by the source
@@ -236,14 +286,13 @@ openal_source::pitch( float const Pitch ) {
 void
 openal_source::loop( bool const State ) {
 
-    if( id == audio::null_resource ) { return; } // no implementation-side source to match, no point
     if( is_looping == State ) { return; }
 
     is_looping = State;
-    ::alSourcei(
-        id,
-        AL_LOOPING,
-        State ? AL_TRUE : AL_FALSE);
+
+    if( id == audio::null_resource ) { return; } // no implementation-side source to match, no point
+
+    set( AL_LOOPING, static_cast<ALint>( State ? AL_TRUE : AL_FALSE ) );
 }
 
 // releases bound buffers and resets state of the class variables
@@ -252,14 +301,8 @@ void
 openal_source::clear() {
 
     if( id != audio::null_resource ) {
-        // unqueue bound buffers:
-        // ensure no buffer is in use...
-        stop();
-        // ...prepare space for returned ids of unqueued buffers (not that we need that info)...
-        std::vector<ALuint> bufferids;
-        bufferids.resize( sounds.size() );
-        // ...release the buffers...
-        ::alSourceUnqueueBuffers( id, bufferids.size(), bufferids.data() );
+        // stop the source and unqueue bound buffers
+        request( command_type::source_release );
     }
     // ...and reset reset the properties, except for the id of the allocated source
     // NOTE: not strictly necessary since except for the id the source data typically get discarded in next step
@@ -268,10 +311,82 @@ openal_source::clear() {
     id = sourceid;
 }
 
+// binds implementation-side source to the voice and resumes its playback
+void
+openal_source::attach( ALuint const Id ) {
+
+    id = Id;
+    renderer.post( { command_type::source_reset, 0, id } );
+    for( auto const buffer : buffers ) {
+        request( command_type::source_queue, static_cast<ALint>( buffer ) );
+    }
+    set( AL_LOOPING, static_cast<ALint>( is_looping ? AL_TRUE : AL_FALSE ) );
+    range( sound_range );
+    set( AL_SEC_OFFSET, static_cast<float>( playback_time ) );
+    // start silent and push all current properties to the source
+    fade = 0.f;
+    auto const state { properties };
+    properties.gain = -1.f;
+    properties.pitch = -1.f;
+    is_in_range = false;
+    sync_with( state );
+    if( true == is_playing ) {
+        play();
+    }
+}
+
+// releases implementation-side source of the voice, which keeps playing virtually. returns: id of released source
+// NOTE: playback position of the voice is the last one reported by the audio thread
+ALuint
+openal_source::detach() {
+
+    request( command_type::source_release );
+
+    auto const sourceid { id };
+    id = audio::null_resource;
+    return sourceid;
+}
+
+void
+openal_source::request( command_type const Type, ALint const Value ) {
+
+    audio::command command { Type, 0, id };
+    command.value = Value;
+    stamp = renderer.post_state( command );
+}
+
+void
+openal_source::set( ALenum const Parameter, float const Value ) {
+
+    audio::command command { command_type::source_float, Parameter, id };
+    command.values[ 0 ] = Value;
+    renderer.post( command );
+}
+
+void
+openal_source::set( ALenum const Parameter, glm::vec3 const &Value ) {
+
+    audio::command command { command_type::source_vector, Parameter, id };
+    command.values[ 0 ] = Value.x;
+    command.values[ 1 ] = Value.y;
+    command.values[ 2 ] = Value.z;
+    renderer.post( command );
+}
+
+void
+openal_source::set( ALenum const Parameter, ALint const Value ) {
+
+    audio::command command { command_type::source_int, Parameter, id };
+    command.value = Value;
+    renderer.post( command );
+}
+
 
 
 openal_renderer::~openal_renderer() {
 
+    exit();
+
     if( m_alcEventCallbackSOFT != nullptr ) { m_alcEventCallbackSOFT( nullptr, nullptr ); } // stop callbacks before teardown
 
     ::alcMakeContextCurrent( nullptr );
@@ -281,7 +396,7 @@ openal_renderer::~openal_renderer() {
 }
 
 // invoked by OpenAL (possibly on an internal thread) on device events; only flags the change,
-// the actual reopen is done on the main thread in update()
+// the actual reopen is done by the audio thread
 void ALC_APIENTRY
 openal_renderer::device_event_callback( ALCenum eventtype, ALCenum devicetype, ALCdevice */*device*/, ALCsizei /*length*/, ALCchar const */*message*/, void *userparam ) noexcept {
 
@@ -319,11 +434,43 @@ openal_renderer::init() {
     }
     ::alDistanceModel( AL_INVERSE_DISTANCE_CLAMPED );
     ::alDopplerFactor( 0.25f );
+    // allocate the whole budget of sources up front, later they're only handed out to the voices
+    for( auto idx = 0; idx < Global.audio_max_sources; ++idx ) {
+        ALuint id;
+        ::alGenSources( 1, &id );
+        ALenum const err { ::alGetError() };
+        if( err != AL_NO_ERROR ) {
+            ErrorLog( "sound: failed to generate source, error: " + std::to_string( err ) );
+            break;
+        }
+        m_sourceslots.emplace( id, m_sourcetracks.size() );
+        m_sourcetracks.push_back( { id } );
+        m_sourcereports.emplace( id, audio::source_report{ id } );
+    }
+    for( auto source { std::rbegin( m_sourcetracks ) }; source != std::rend( m_sourcetracks ); ++source ) {
+        m_sourcespares.push( source->id );
+    }
+    WriteLog( "sound: allocated " + std::to_string( m_sourcetracks.size() ) + " sources" );
+    // from now on the implementation is driven by the audio thread
+    m_exit = false;
+    m_thread = std::thread( &openal_renderer::run, this );
     // all done
     m_ready = true;
     return true;
 }
 
+// stops the audio thread
+void
+openal_renderer::exit() {
+
+    if( false == m_thread.joinable() ) { return; }
+
+    m_exit = true;
+    m_condition.notify_one();
+    m_thread.join();
+    m_ready = false;
+}
+
 // removes from the queue all sounds controlled by the specified sound emitter
 void
 openal_renderer::erase( sound_source const *Controller ) {
@@ -347,73 +494,36 @@ openal_renderer::erase( sound_source const *Controller ) {
 }
 
 // updates state of all active emitters
+// NOTE: the implementation is only passed requests, which are executed by the audio thread
 void
 openal_renderer::update( double const Deltatime ) {
 
-    ALenum err = alGetError();
-    if (err != AL_NO_ERROR)
-    {
-        std::string errname;
-        if (err == AL_INVALID_NAME)
-            errname = "AL_INVALID_NAME";
-        else if (err == AL_INVALID_ENUM)
-            errname = "AL_INVALID_ENUM";
-        else if (err == AL_INVALID_VALUE)
-            errname = "AL_INVALID_VALUE";
-        else if (err == AL_INVALID_OPERATION)
-            errname = "AL_INVALID_OPERATION";
-        else if (err == AL_OUT_OF_MEMORY)
-            errname = "AL_OUT_OF_MEMORY";
-        else
-            errname = "unknown";
-
-        ErrorLog("sound: al error: " + errname);
+    // collect state of implementation-side sources
+    audio::source_report report;
+    while( true == m_reports.pop( report ) ) {
+        m_sourcereports[ report.source ] = report;
     }
 
-    if (Deltatime == 0.0)
-    {
-        if (m_alcDevicePauseSOFT)
-            m_alcDevicePauseSOFT(m_device);
+    if( Deltatime == 0.0 ) {
+        if( false == m_paused ) {
+            m_paused = true;
+            post( { command_type::device_pause } );
+            post( { command_type::frame } );
+        }
         return;
     }
-
-    if (m_alcDeviceResumeSOFT)
-        m_alcDeviceResumeSOFT(m_device);
-
-    // keep audio on the correct output (OpenAL won't re-route on its own). Reopen playback on the
-    // current default output when the active device is lost (headphones unplugged) or the system
-    // default output changes (headphones plugged back in, or default switched in Windows). NULL
-    // device name selects the current default; context and sources are preserved.
-    if( m_alcReopenDeviceSOFT != nullptr && Global.AudioRenderer.empty() ) {
-        bool needsreopen{ false };
-        if( m_usedeviceevents ) {
-            // event-driven: the callback (any thread) flags default-output / device-removal changes
-            needsreopen = m_outputchanged.exchange( false );
-        }
-        else if( m_candetectdisconnect ) {
-            // fallback without ALC_SOFT_system_events: poll for a hard disconnect at ~1 Hz
-            m_devicechecktime += Deltatime;
-            if( m_devicechecktime >= 1.0 ) {
-                m_devicechecktime = 0.0;
-                ALCint connected{ ALC_TRUE };
-                ::alcGetIntegerv( m_device, ALC_CONNECTED, 1, &connected );
-                needsreopen = ( connected == ALC_FALSE );
-            }
-        }
-        if( needsreopen ) {
-            if( m_alcReopenDeviceSOFT( m_device, nullptr, m_contextattributes ) == ALC_TRUE ) {
-                auto const *nowon { (char const *)::alcGetString( nullptr, ALC_DEFAULT_ALL_DEVICES_SPECIFIER ) };
-                WriteLog( "sound: audio output changed, reopened playback on \"" + std::string{ nowon ? nowon : "?" } + "\"" );
-            }
-            else {
-                ErrorLog( "sound: audio output changed but reopening on the default device failed (will retry)" );
-            }
-        }
+    if( true == m_paused ) {
+        m_paused = false;
+        post( { command_type::device_resume } );
     }
 
     // update listener
     // gain
-    ::alListenerf( AL_GAIN, Global.AudioVolume );
+    {
+        audio::command command { command_type::listener_float, AL_GAIN };
+        command.values[ 0 ] = Global.AudioVolume;
+        post( command );
+    }
     // orientation
     glm::dmat4 cameramatrix;
     Global.pCamera.SetMatrix( cameramatrix );
@@ -426,8 +536,12 @@ openal_renderer::update( double const Deltatime ) {
     // padding as garbage, corrupting the listener basis (left/right swapped).
     auto const at { glm::vec3{ 0, 0,-1 } * rotationmatrix };
     auto const up { glm::vec3{ 0, 1, 0 } * rotationmatrix };
-    ALfloat const orientation[ 6 ] = { at.x, at.y, at.z, up.x, up.y, up.z };
-    ::alListenerfv( AL_ORIENTATION, orientation );
+    {
+        audio::command command { command_type::listener_orientation, AL_ORIENTATION };
+        std::copy( glm::value_ptr( at ), glm::value_ptr( at ) + 3, command.values );
+        std::copy( glm::value_ptr( up ), glm::value_ptr( up ) + 3, command.values + 3 );
+        post( command );
+    }
     // velocity
     if( Deltatime > 0 ) {
         auto cameramove { cameraposition - cached_camerapos };
@@ -454,7 +568,9 @@ openal_renderer::update( double const Deltatime ) {
         }
         m_listenervelocity = limit_velocity( cameramove / Deltatime );
 
-        ::alListenerfv( AL_VELOCITY, reinterpret_cast<ALfloat const *>( glm::value_ptr( m_listenervelocity ) ) );
+        audio::command command { command_type::listener_vector, AL_VELOCITY };
+        std::copy( glm::value_ptr( m_listenervelocity ), glm::value_ptr( m_listenervelocity ) + 3, command.values );
+        post( command );
     }
 
     // update active emitters
@@ -477,84 +593,327 @@ openal_renderer::update( double const Deltatime ) {
         }
     }
 
+    // hand out implementation-side sources to voices which can be heard the most
+    update_voices();
+
     // reset potentially used volume change flag
     audio::event_volume_change = false;
 
-    if (m_alProcessUpdatesSOFT && m_alDeferUpdatesSOFT)
-    {
-        m_alProcessUpdatesSOFT();
-        m_alDeferUpdatesSOFT();
-    }
+    // pass the frame to the audio thread
+    post( { command_type::frame } );
+    m_condition.notify_one();
 }
 
 // returns an instance of implementation-side part of the sound emitter
+// NOTE: if there's no source available the emitter starts as a virtual voice, and receives a source when it's audible enough
 audio::openal_source
 openal_renderer::fetch_source() {
 
     audio::openal_source newsource;
-    if( false == m_sourcespares.empty() ) {
-        // reuse (a copy of) already allocated source
-        newsource.id = m_sourcespares.top();
-        m_sourcespares.pop();
-    }
-    if( newsource.id == audio::null_resource ) {
-        // if there's no source to reuse, try to generate a new one
-        ::alGenSources( 1, &newsource.id );
-        // Check for errors
-        ALenum err = alGetError();
-        if (err != AL_NO_ERROR) {
-            ErrorLog("sound: failed to generate source, error: " + std::to_string(err));
-            newsource.id = audio::null_resource;
-        }
-    }
-    if( newsource.id == audio::null_resource ) {
-        // if we still don't have a working source, see if we can sacrifice an already active one
-        // under presumption it's more important to play new sounds than keep the old ones going
-        // TBD, TODO: for better results we could use range and/or position for the new sound
-        // to better weight whether the new sound is really more important
-        auto leastimportantsource { std::end( m_sources ) };
-        auto leastimportantweight { std::numeric_limits<float>::max() };
-
-        for( auto source { std::begin( m_sources ) }; source != std::cend( m_sources ); ++source ) {
-
-            if( source->id == audio::null_resource
-             || true == source->is_multipart
-             || false == source->is_playing ) {
+    newsource.id = fetch_source_id();
+    if( newsource.id != audio::null_resource ) {
+        // for sources with functional emitter reset emitter parameters from potential last use
+        post( { command_type::source_reset, 0, newsource.id } );
+    }
+
+    return newsource;
+}
+
+// provides id of spare implementation-side source, or null_resource if all sources are in use
+ALuint
+openal_renderer::fetch_source_id() {
+
+    if( true == m_sourcespares.empty() ) {
+        return audio::null_resource;
+    }
+    auto const id { m_sourcespares.top() };
+    m_sourcespares.pop();
+    return id;
+}
+
+// queues a request for the audio thread
+void
+openal_renderer::post( audio::command const &Command ) {
+
+    if( false == m_ready ) { return; }
+
+    while( false == m_commands.push( Command ) ) {
+        // the audio thread fell behind by multiple frames. requests can't be dropped without breaking source state, so wait
+        m_condition.notify_one();
+        std::this_thread::yield();
+    }
+}
 
+// queues a request changing playback state of a source. returns: stamp of the request
+std::uint32_t
+openal_renderer::post_state( audio::command Command ) {
+
+    // stamps only have to be unique per source, whose requests come from one thread at a time
+    Command.stamp = m_stamp.fetch_add( 1, std::memory_order_relaxed ) + 1;
+    post( Command );
+    return Command.stamp;
+}
+
+// provides last reported state of specified implementation-side source, or nullptr if there's none
+audio::source_report const *
+openal_renderer::report( ALuint const Source ) const {
+
+    auto const lookup { m_sourcereports.find( Source ) };
+    return (
+        lookup != std::end( m_sourcereports ) ?
+            &lookup->second :
+            nullptr );
+}
+
+// audio thread main loop
+void
+openal_renderer::run() {
+
+    auto lastframe { std::chrono::steady_clock::now() };
+    audio::command command;
+    while( false == m_exit.load() ) {
+        m_condition.wait_for( std::chrono::milliseconds( 50 ) );
+        m_condition.spurious( true );
+        // requests and their error check are executed together, without interference from buffer creation
+        std::lock_guard<std::mutex> lock { audio::error_lock };
+        while( true == m_commands.pop( command ) ) {
+            if( command.type != command_type::frame ) {
+                execute( command );
                 continue;
             }
-            auto const sourceweight { (
-                source->sound_range != -1 ?
-                    source->sound_range * source->sound_range / ( static_cast<float>( glm::length2( source->sound_distance ) ) + 1 ) :
-                    std::numeric_limits<float>::max() ) };
-            if( sourceweight < leastimportantweight ) {
-                leastimportantsource = source;
-                leastimportantweight = sourceweight;
+            // end of the frame
+            PROFILE_ZONE( "audio" );
+            if( m_alProcessUpdatesSOFT && m_alDeferUpdatesSOFT ) {
+                m_alProcessUpdatesSOFT();
+                m_alDeferUpdatesSOFT();
             }
+            report_sources();
+            check_errors();
+            auto const now { std::chrono::steady_clock::now() };
+            check_output( std::chrono::duration<double>( now - lastframe ).count() );
+            lastframe = now;
         }
-        if( leastimportantsource != std::end(m_sources)
-         && leastimportantweight < 1.f ) {
-            // only accept the candidate if it's outside of its nominal hearing range
-            leastimportantsource->stop();
-            // HACK: dt of 0 is a roundabout way to notify the controller its emitter has stopped
-            leastimportantsource->update( 0, m_listenervelocity );
-            leastimportantsource->clear();
-            // we should be now free to grab the id and get rid of the remains
-            newsource.id = leastimportantsource->id;
-            m_sources.erase( leastimportantsource );
+    }
+}
+
+// passes provided request to the implementation
+void
+openal_renderer::execute( audio::command const &Command ) {
+
+    auto const id { Command.source };
+    if( Command.stamp != 0 ) {
+        // playback state change, track it for the reports
+        auto const lookup { m_sourceslots.find( id ) };
+        if( lookup != std::end( m_sourceslots ) ) {
+            m_sourcetracks[ lookup->second ].stamp = Command.stamp;
+            m_sourcetracks[ lookup->second ].reported = false;
         }
     }
 
-    if( newsource.id != audio::null_resource ) {
-        // for sources with functional emitter reset emitter parameters from potential last use
-        ::alSourcef( newsource.id, AL_PITCH, 1.f );
-        ::alSourcef( newsource.id, AL_GAIN, 1.f );
-        glm::vec3 zero_pos{ 0.f, 0.f, 0.f };
-        ::alSourcefv( newsource.id, AL_POSITION, glm::value_ptr( zero_pos ) );
-        ::alSourcefv( newsource.id, AL_VELOCITY, glm::value_ptr( zero_pos ) );
+    switch( Command.type ) {
+        case command_type::source_reset: {
+            glm::vec3 const zero_pos { 0.f, 0.f, 0.f };
+            ::alSourcef( id, AL_PITCH, 1.f );
+            ::alSourcef( id, AL_GAIN, 1.f );
+            ::alSourcefv( id, AL_POSITION, glm::value_ptr( zero_pos ) );
+            ::alSourcefv( id, AL_VELOCITY, glm::value_ptr( zero_pos ) );
+            break;
+        }
+        case command_type::source_float: {
+            ::alSourcef( id, Command.parameter, Command.values[ 0 ] );
+            break;
+        }
+        case command_type::source_vector: {
+            ::alSourcefv( id, Command.parameter, Command.values );
+            break;
+        }
+        case command_type::source_int: {
+            ::alSourcei( id, Command.parameter, Command.value );
+            break;
+        }
+        case command_type::source_queue: {
+            auto const buffer { static_cast<ALuint>( Command.value ) };
+            ::alSourceQueueBuffers( id, 1, &buffer );
+            break;
+        }
+        case command_type::source_unqueue: {
+            std::vector<ALuint> discard( static_cast<std::size_t>( Command.value ) );
+            ::alSourceUnqueueBuffers( id, Command.value, discard.data() );
+            break;
+        }
+        case command_type::source_rewind: {
+            ::alSourceRewind( id );
+            break;
+        }
+        case command_type::source_play: {
+            ::alSourcePlay( id );
+            break;
+        }
+        case command_type::source_stop:
+        case command_type::source_release: {
+            // NOTE: workaround for potential edge cases where ::alSourceStop() doesn't set source which wasn't yet started to AL_STOPPED
+            ALint state;
+            ::alGetSourcei( id, AL_SOURCE_STATE, &state );
+            if( state == AL_INITIAL ) {
+                ::alSourcePlay( id );
+            }
+            ::alSourceStop( id );
+            if( Command.type == command_type::source_release ) {
+                ::alSourcei( id, AL_BUFFER, 0 );
+            }
+            break;
+        }
+        case command_type::listener_float: {
+            ::alListenerf( Command.parameter, Command.values[ 0 ] );
+            break;
+        }
+        case command_type::listener_vector:
+        case command_type::listener_orientation: {
+            ::alListenerfv( Command.parameter, Command.values );
+            break;
+        }
+        case command_type::device_pause: {
+            if( m_alcDevicePauseSOFT ) {
+                m_alcDevicePauseSOFT( m_device );
+            }
+            break;
+        }
+        case command_type::device_resume: {
+            if( m_alcDeviceResumeSOFT ) {
+                m_alcDeviceResumeSOFT( m_device );
+            }
+            break;
+        }
+        default: {
+            break;
+        }
     }
+}
 
-    return newsource;
+// sends state of changed and playing sources to the simulation
+void
+openal_renderer::report_sources() {
+
+    for( auto &source : m_sourcetracks ) {
+        ALint state, processed;
+        ::alGetSourcei( source.id, AL_SOURCE_STATE, &state );
+        ::alGetSourcei( source.id, AL_BUFFERS_PROCESSED, &processed );
+        if( true == source.reported
+         && state == source.state
+         && processed == source.processed
+         && state != AL_PLAYING ) {
+            // nothing new to report
+            continue;
+        }
+        audio::source_report report { source.id, source.stamp, state, processed };
+        if( state == AL_PLAYING ) {
+            ::alGetSourcef( source.id, AL_SEC_OFFSET, &report.offset );
+        }
+        if( false == m_reports.push( report ) ) {
+            // the simulation fell behind, retry during next frame
+            continue;
+        }
+        source.state = state;
+        source.processed = processed;
+        source.reported = true;
+    }
+}
+
+void
+openal_renderer::check_errors() {
+
+    ALenum err = alGetError();
+    if (err != AL_NO_ERROR)
+    {
+        std::string errname;
+        if (err == AL_INVALID_NAME)
+            errname = "AL_INVALID_NAME";
+        else if (err == AL_INVALID_ENUM)
+            errname = "AL_INVALID_ENUM";
+        else if (err == AL_INVALID_VALUE)
+            errname = "AL_INVALID_VALUE";
+        else if (err == AL_INVALID_OPERATION)
+            errname = "AL_INVALID_OPERATION";
+        else if (err == AL_OUT_OF_MEMORY)
+            errname = "AL_OUT_OF_MEMORY";
+        else
+            errname = "unknown";
+
+        ErrorLog("sound: al error: " + errname);
+    }
+}
+
+// keep audio on the correct output (OpenAL won't re-route on its own). Reopen playback on the
+// current default output when the active device is lost (headphones unplugged) or the system
+// default output changes (headphones plugged back in, or default switched in Windows). NULL
+// device name selects the current default; context and sources are preserved.
+void
+openal_renderer::check_output( double const Deltatime ) {
+
+    if( m_alcReopenDeviceSOFT == nullptr || false == Global.AudioRenderer.empty() ) { return; }
+
+    bool needsreopen{ false };
+    if( m_usedeviceevents ) {
+        // event-driven: the callback (any thread) flags default-output / device-removal changes
+        needsreopen = m_outputchanged.exchange( false );
+    }
+    else if( m_candetectdisconnect ) {
+        // fallback without ALC_SOFT_system_events: poll for a hard disconnect at ~1 Hz
+        m_devicechecktime += Deltatime;
+        if( m_devicechecktime >= 1.0 ) {
+            m_devicechecktime = 0.0;
+            ALCint connected{ ALC_TRUE };
+            ::alcGetIntegerv( m_device, ALC_CONNECTED, 1, &connected );
+            needsreopen = ( connected == ALC_FALSE );
+        }
+    }
+    if( needsreopen ) {
+        if( m_alcReopenDeviceSOFT( m_device, nullptr, m_contextattributes ) == ALC_TRUE ) {
+            auto const *nowon { (char const *)::alcGetString( nullptr, ALC_DEFAULT_ALL_DEVICES_SPECIFIER ) };
+            WriteLog( "sound: audio output changed, reopened playback on \"" + std::string{ nowon ? nowon : "?" } + "\"" );
+        }
+        else {
+            ErrorLog( "sound: audio output changed but reopening on the default device failed (will retry)" );
+        }
+    }
+}
+
+// assigns implementation-side sources to the most audible voices
+// the remaining voices keep playing virtually, with their state tracked but no work done by the implementation
+void
+openal_renderer::update_voices() {
+
+    std::vector<audio::openal_source *> voices;
+    voices.reserve( m_sources.size() );
+    for( auto &source : m_sources ) {
+        if( true == source.is_playing ) {
+            voices.emplace_back( &source );
+        }
+    }
+    auto const voicelimit { std::min<std::size_t>( voices.size(), std::max( 0, Global.audio_max_sources ) ) };
+    auto const priority {
+        []( audio::openal_source const *Voice ) {
+            return Voice->audibility * ( Voice->id != audio::null_resource ? EU07_SOUND_VOICEPRIORITYBONUS : 1.f ); } };
+    std::nth_element(
+        std::begin( voices ), std::begin( voices ) + voicelimit, std::end( voices ),
+        [&]( audio::openal_source const *Left, audio::openal_source const *Right ) {
+            return priority( Left ) > priority( Right ); } );
+    // take away sources from voices which didn't make the cut...
+    for( auto voice { std::begin( voices ) + voicelimit }; voice != std::end( voices ); ++voice ) {
+        if( ( *voice )->id != audio::null_resource ) {
+            m_sourcespares.push( ( *voice )->detach() );
+        }
+    }
+    // ...and give them to the audible voices lacking one
+    for( auto voice { std::begin( voices ) }; voice != std::begin( voices ) + voicelimit; ++voice ) {
+        if( ( *voice )->id != audio::null_resource
+         || ( *voice )->audibility <= 0.f ) {
+            continue;
+        }
+        auto const id { fetch_source_id() };
+        if( id == audio::null_resource ) { break; }
+        ( *voice )->attach( id );
+    }
 }
 
 bool
@@ -12,6 +12,7 @@ http://mozilla.org/MPL/2.0/.
 #include "audio/audio.h"
 #include "model/ResourceManager.h"
 #include "application/uitranscripts.h"
+#include "utilities/utilities.h"
 
 // Dodaj brakujące includy
 #include <list>
@@ -59,6 +60,45 @@ enum class sync_state {
 
 namespace audio {
 
+// request passed by the simulation to the audio thread
+enum class command_type : std::uint8_t {
+    source_reset, // restores default pitch, gain, position and velocity
+    source_float, // sets float parameter of the source
+    source_vector, // sets vector parameter of the source
+    source_int, // sets integer parameter of the source
+    // requests below change playback state of the source
+    source_queue, // queues specified buffer
+    source_unqueue, // releases specified number of processed buffers
+    source_rewind,
+    source_play,
+    source_stop,
+    source_release, // stops the source and releases all its buffers
+    listener_float,
+    listener_vector,
+    listener_orientation,
+    device_pause,
+    device_resume,
+    frame // marks end of requests for the current frame
+};
+
+struct command {
+    command_type type;
+    ALenum parameter { 0 };
+    ALuint source { audio::null_resource };
+    std::uint32_t stamp { 0 }; // sequence number of playback state change
+    ALint value { 0 };
+    float values[ 6 ] {};
+};
+
+// state of implementation-side source, reported back by the audio thread
+struct source_report {
+    ALuint source { audio::null_resource };
+    std::uint32_t stamp { 0 }; // stamp of the last playback state change applied to the source
+    ALint state { AL_INITIAL };
+    ALint processed { 0 }; // number of processed buffers
+    float offset { 0.f }; // seconds; playback position within the first queued buffer
+};
+
 struct openal_source {
 
     friend class openal_renderer;
@@ -90,6 +130,19 @@ struct openal_source {
     void clear();
 
 private:
+    // binds implementation-side source to the voice and resumes its playback
+    void attach( ALuint const Id );
+    // releases implementation-side source of the voice, which keeps playing virtually. returns: id of released source
+    ALuint detach();
+    // advances playback of the voice without implementation-side source
+    void update_virtual( double const Deltatime );
+    // passes request changing playback state to the implementation-side source
+    void request( command_type const Type, ALint const Value = 0 );
+    // passes new parameter value to the implementation-side source
+    void set( ALenum const Parameter, float const Value );
+    void set( ALenum const Parameter, glm::vec3 const &Value );
+    void set( ALenum const Parameter, ALint const Value );
+
     double update_deltatime { 0.0 };
     float pitch_variation { 1.f };
     float sound_range { 50.f };
@@ -97,11 +150,18 @@ private:
     glm::vec3 sound_velocity { 0.f };
     bool is_in_range { false };
     bool is_multipart { false };
+    std::vector<ALuint> buffers; // queued buffers, kept to restore the voice after its source was taken away
+    std::vector<float> buffer_lengths; // seconds; playback time of the queued buffers
+    double playback_time { 0.0 }; // seconds; playback position within the first queued buffer, tracked for virtual voices
+    float fade { 1.f }; // gain multiplier, raised from 0 after the voice receives implementation-side source
+    float audibility { 0.f }; // estimated loudness of the voice at the listener position
+    std::uint32_t stamp { 0 }; // stamp of the last playback state change requested for implementation-side source
 };
 
 class openal_renderer {
 
     friend opengl_renderer;
+    friend openal_source;
 
 public:
     openal_renderer() = default;
@@ -111,6 +171,8 @@ public:
     audio::openal_buffer const &buffer( audio::buffer_handle const Buffer ) const;
 
     bool init();
+    // stops the audio thread
+    void exit();
 
     template <class Iterator_>
     void insert( Iterator_ First, Iterator_ Last, sound_source *Controller, uint32_sequence Sounds ) {
@@ -128,6 +190,22 @@ private:
 
     bool init_caps();
     audio::openal_source fetch_source();
+    // provides id of spare implementation-side source, or null_resource if all sources are in use
+    ALuint fetch_source_id();
+    // assigns implementation-side sources to the most audible voices
+    void update_voices();
+    // queues a request for the audio thread
+    void post( audio::command const &Command );
+    // queues a request changing playback state of a source. returns: stamp of the request
+    std::uint32_t post_state( audio::command Command );
+    // provides last reported state of specified implementation-side source, or nullptr if there's none
+    audio::source_report const *report( ALuint const Source ) const;
+    // audio thread methods
+    void run();
+    void execute( audio::command const &Command );
+    void report_sources();
+    void check_errors();
+    void check_output( double const Deltatime );
 
     ALCdevice *m_device { nullptr };
     ALCcontext *m_context { nullptr };
@@ -140,6 +218,27 @@ private:
     buffer_manager m_buffers;
     source_list m_sources;
     source_sequence m_sourcespares;
+    std::unordered_map<ALuint, audio::source_report> m_sourcereports; // last reported state of implementation-side sources
+    std::atomic<std::uint32_t> m_stamp { 0 }; // sequence of playback state change requests
+    bool m_paused { false };
+    // audio thread
+    // NOTE: outside of initialization and buffer creation the implementation is accessed only by the audio thread.
+    // buffer creation and execution of the requests are serialized through audio::error_lock.
+    // the simulation passes requests through the command queue and receives state of the sources through the report queue
+    struct source_track {
+        ALuint id { audio::null_resource };
+        std::uint32_t stamp { 0 };
+        ALint state { AL_INITIAL };
+        ALint processed { 0 };
+        bool reported { true };
+    };
+    threading::mpsc_queue<audio::command> m_commands { 1 << 15 }; // sounds can be started by concurrent train updates, so requests have multiple producers
+    threading::spsc_queue<audio::source_report> m_reports { 1 << 12 };
+    std::unordered_map<ALuint, std::size_t> m_sourceslots; // read-only after initialization
+    std::vector<source_track> m_sourcetracks; // accessed only by the audio thread
+    threading::condition_variable m_condition; // wakes up the audio thread
+    std::atomic<bool> m_exit { false };
+    std::thread m_thread;
 
     // OpenAL Soft extension entry points, resolved at runtime via al(c)GetProcAddress
     LPALDEFERUPDATESSOFT m_alDeferUpdatesSOFT { nullptr };
@@ -8,34 +8,32 @@ openal_source::bind( sound_source *Controller, uint32_sequence Sounds, Iterator_
     controller = Controller;
     sounds = Sounds;
     // look up and queue assigned buffers
-    std::vector<ALuint> buffers;
+    buffers.clear();
+    buffer_lengths.clear();
     std::for_each(
         First, Last,
         [&]( audio::buffer_handle const &bufferhandle ) {
             auto const &buffer { audio::renderer.buffer( bufferhandle ) };
-			if (buffer.id != null_resource) buffers.emplace_back( buffer.id ); } );
+            if( buffer.id != null_resource ) {
+                buffers.emplace_back( buffer.id );
+                // cache playback times, for voices which have to be tracked without implementation-side source
+                buffer_lengths.emplace_back( buffer.length ); } } );
 
     is_multipart = buffers.size() > 1;
+    // sound controller can potentially request playback to start from certain buffer point
+    // for multipart sounds the offset is applied only to last piece during playback
+    // for single sound we also make sure not to apply the offset to optional bookends
+    playback_time = (
+        ( buffers.empty() || controller->start() == 0.f || is_multipart || controller->is_bookend( buffers.front() ) ) ?
+            0.0 : // regular case with no offset
+            controller->start() * buffer_lengths.front() ); // move playback start to specified point in 0-1 range
 
     if( id != audio::null_resource && !buffers.empty()) {
-        ::alSourceQueueBuffers( id, static_cast<ALsizei>( buffers.size() ), buffers.data() );
-        ::alSourceRewind( id );
-        // sound controller can potentially request playback to start from certain buffer point
-        // for multipart sounds the offset is applied only to last piece during playback
-        // for single sound we also make sure not to apply the offset to optional bookends
-        if( controller->start() == 0.f || is_multipart || controller->is_bookend( buffers.front() ) ) {
-            // regular case with no offset, reset bound source just in case
-            ::alSourcei( id, AL_SAMPLE_OFFSET, 0 );
-        }
-        else {
-            // move playback start to specified point in 0-1 range
-            ALint buffersize;
-            ::alGetBufferi( buffers.front(), AL_SIZE, &buffersize );
-            ::alSourcei(
-                id,
-                AL_SAMPLE_OFFSET,
-                static_cast<ALint>( controller->start() * ( buffersize / sizeof( std::int16_t ) ) ) );
+        for( auto const buffer : buffers ) {
+            request( command_type::source_queue, static_cast<ALint>( buffer ) );
         }
+        request( command_type::source_rewind );
+        set( AL_SEC_OFFSET, static_cast<float>( playback_time ) );
     }
 
     return *this;
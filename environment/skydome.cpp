@@ -87,6 +87,7 @@ void CSkyDome::Generate() {
 */
             // cartesian to opengl swap: -x, -z, -y
             m_vertices.emplace_back( glm::vec3( -x * zr, -z - offset, -y * zr ) * radius );
+            m_directions.emplace_back( glm::normalize( m_vertices.back() ) );
             m_colours.emplace_back( glm::vec3( 0.75f, 0.75f, 0.75f ) ); // placeholder
 
             if( i == 0 || j == 0 ) {
@@ -109,12 +110,32 @@ void CSkyDome::Generate() {
 
 void CSkyDome::Update( glm::vec3 const &Sun ) {
 	SetTurbidity(Global.fTurbidity);
-    if( true == SetSunPosition( Sun ) ) {
-        // build colors if there's a change in sun position
+    SetSunPosition( Sun );
+    if( true == is_outdated() ) {
+        // build colors if there's a change in sun position or sky conditions
         RebuildColors();
     }
 }
 
+bool CSkyDome::is_outdated() const {
+
+    // the sun moves by about 0.004 degree per second of simulation time. rebuilding the colors for every such step
+    // doesn't make a visible difference, so we wait until it moves by 0.05 degree
+    // NOTE: the threshold is within few float ulps of 1, so the test is done in double precision, with the lengths taken into account
+    auto const sunmovementthreshold { 0.9999996192378 }; // cos( 0.05 deg )
+    glm::dvec3 const sundirection { m_sundirection };
+    glm::dvec3 const colorsundirection { m_colorsundirection };
+
+    return ( glm::dot( sundirection, colorsundirection ) < sunmovementthreshold * glm::length( sundirection ) * glm::length( colorsundirection ) )
+        || ( m_turbidity != m_colorturbidity )
+        || ( m_overcast != m_colorovercast )
+        || ( m_expfactor != m_colorexpfactor )
+        || ( m_linearexpcontrol != m_colorlinearexpcontrol )
+        // color corrections can be adjusted live through the ui
+        || ( Global.m_skysaturationcorrection != m_colorsaturationcorrection )
+        || ( Global.m_skyhuecorrection != m_colorhuecorrection );
+}
+
 // render skydome to screen
 bool CSkyDome::SetSunPosition( glm::vec3 const &Direction ) {
 
@@ -184,6 +205,14 @@ float CSkyDome::PerezFunctionO2( float Perezcoeffs[ 5 ], const float Icostheta,
 
 void CSkyDome::RebuildColors() {
 
+    m_colorsundirection = m_sundirection;
+    m_colorturbidity = m_turbidity;
+    m_colorovercast = m_overcast;
+    m_colorexpfactor = m_expfactor;
+    m_colorlinearexpcontrol = m_linearexpcontrol;
+    m_colorsaturationcorrection = Global.m_skysaturationcorrection;
+    m_colorhuecorrection = Global.m_skyhuecorrection;
+
     float twilightfactor = std::clamp( -simulation::Environment.sun().getAngle(), 0.0f, 18.0f ) / 18.0f;
     auto gammacorrection = glm::mix( glm::vec3( 1.0f ), glm::vec3( 0.45f ), twilightfactor );
 
@@ -215,10 +244,11 @@ void CSkyDome::RebuildColors() {
 
 	for ( unsigned int i = 0; i < m_vertices.size(); ++i ) {
 		// grab it
-		vertex = glm::normalize( m_vertices[ i ] );
+		vertex = m_directions[ i ];
 
 		// angle between sun and vertex
-		const float gamma = std::acos( glm::dot( vertex, m_sundirection ) );
+		float const cosgamma = std::clamp( glm::dot( vertex, m_sundirection ), -1.0f, 1.0f );
+		const float gamma = std::acos( cosgamma );
 
 		// warning : major hack!!! .. i had to do something with values under horizon
 		//vertex.y = Clamp<float>( vertex.y, 0.05f, 1.0f );
@@ -232,7 +262,7 @@ void CSkyDome::RebuildColors() {
 //				= 1.0f / cosf( arccos( vertex.y ) );
 //				= 1.0f / vertex.y;
 		float const icostheta = 1.0f / vertex.y;
-		float const cosgamma2 = std::pow( std::cos( gamma ), 2 );
+		float const cosgamma2 = cosgamma * cosgamma;
 
 		// Compute x,y values  
 		float const x = PerezFunctionO2( perezx, icostheta, gamma, cosgamma2, zenithx );
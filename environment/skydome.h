@@ -35,6 +35,14 @@ public:
 private:
 	// shading parametrs
     glm::vec3 m_sundirection;
+    // shading parameters used by the last color rebuild
+    glm::vec3 m_colorsundirection { 0.f };
+    float m_colorturbidity { -1.f };
+    float m_colorovercast { -1.f };
+    float m_colorexpfactor { -1.f };
+    bool m_colorlinearexpcontrol { false };
+    float m_colorsaturationcorrection { -1.f };
+    float m_colorhuecorrection { -1.f };
     float m_thetasun, m_phisun;
     float m_turbidity;
     bool m_linearexpcontrol;
@@ -49,6 +57,7 @@ private:
     std::vector<std::uint16_t> m_indices;
 //    std::vector<float3> m_normals;
     std::vector<glm::vec3> m_colours;
+    std::vector<glm::vec3> m_directions; // normalized vertex positions. the lower bound of the vertical component is applied when colors are calculated
     bool m_dirty { true }; // indicates sync state between simulation and gpu sides
 
 	static float m_distributionluminance[ 5 ][ 2 ];
@@ -59,6 +68,8 @@ private:
     static float m_zenithymatrix[ 3 ][ 4 ];
 	
 	// coloring
+    // returns: true if the shading parameters changed enough since the last color rebuild to make it noticeable
+    bool is_outdated() const;
 	void GetPerez( float *Perez, float Distribution[ 5 ][ 2 ], const float Turbidity );
 	float GetZenith( float Zenithmatrix[ 3 ][ 4 ], const float Theta, const float Turbidity );		
 	float PerezFunctionO1( float Perezcoeffs[ 5 ], const float Thetasun, const float Zenithval );
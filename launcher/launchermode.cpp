@@ -17,6 +17,8 @@ bool launcher_mode::init()
 
 bool launcher_mode::update()
 {
+	m_userinterface->update();
+
 	return true;
 }
 
@@ -3,9 +3,9 @@
 #include "application/application.h"
 #include "utilities/translation.h"
 
-launcher_ui::launcher_ui() : m_scenery_scanner(m_vehicles_bank), m_scenerylist_panel(m_scenery_scanner)
+launcher_ui::launcher_ui() : m_scenery_scanner(m_vehicles_bank), m_scenerylist_panel(m_scenery_scanner), m_vehiclepicker_panel(m_vehicles_bank)
 {
-	m_vehicles_bank.scan_textures();
+	// panels are filled as the scan results arrive
 	m_scenery_scanner.scan();
 
 	add_external_panel(&m_scenerylist_panel);
@@ -27,6 +27,13 @@ bool launcher_ui::on_key(const int Key, const int Action)
 	return ui_layer::on_key(Key, Action);
 }
 
+void launcher_ui::update()
+{
+	m_scenery_scanner.update();
+
+	ui_layer::update();
+}
+
 void launcher_ui::on_window_resize(int w, int h)
 {
 	open_panel(m_current_panel);
@@ -21,6 +21,7 @@ public:
 	launcher_ui();
 	bool on_key(int Key, int Action) override;
 	void on_window_resize(int w, int h) override;
+	void update() override;
 
 private:
 	void render_() override;
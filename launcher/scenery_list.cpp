@@ -31,6 +31,9 @@ bool ui::scenerylist_panel::on_key(int key, int action)
 
 void ui::scenerylist_panel::draw_scenery_list()
 {
+	if (scanner.scanning())
+		ImGui::TextDisabled("%s", STR_C("Scanning scenarios..."));
+
 	// Draw all the scenarios which are not assigned to any category.
 	for (auto &desc : scanner.scenarios) {
 		std::string name = desc.path.stem().string();
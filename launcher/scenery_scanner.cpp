@@ -1,35 +1,158 @@
 #include "stdafx.h"
 #include "scenery_scanner.h"
+#include "scene/sn_utils.h"
 #include "utilities/Logs.h"
 
+namespace {
+
+std::string const EU07_FILEEXTENSION_SCENARIO { ".scn" };
+std::string const EU07_LAUNCHERINDEX { "scenery/launcher.idx" };
+std::uint32_t const EU07_FILEHEADER { MAKE_ID4( 'E','U','0','7' ) };
+std::uint32_t const EU07_FILEVERSION_LAUNCHERINDEX { MAKE_ID4( 'L', 'I', 'X', '1' ) };
+
+// identifies version of the scenario file, to detect files changed since they were indexed
+std::pair<std::int64_t, std::uint64_t> file_stamp(std::filesystem::path const &Path)
+{
+	std::error_code error;
+	auto const timestamp { std::filesystem::last_write_time(Path, error) };
+	auto const size { std::filesystem::file_size(Path, error) };
+	if (error)
+		return { 0, 0 };
+
+	return { static_cast<std::int64_t>(timestamp.time_since_epoch().count()), static_cast<std::uint64_t>(size) };
+}
+
+} // namespace
+
 scenery_scanner::scenery_scanner(ui::vehicles_bank &bank)
     : bank(bank)
 {
 
 }
 
+scenery_scanner::~scenery_scanner()
+{
+	cancelled = true;
+	if (vehicles_thread.joinable())
+		vehicles_thread.join();
+	if (scenarios_thread.joinable())
+		scenarios_thread.join();
+}
+
 void scenery_scanner::scan()
 {
-	for (auto &f : std::filesystem::directory_iterator("scenery")) {
-		std::filesystem::path path(std::filesystem::relative(f.path(), "scenery/"));
+	// vehicle definitions and scenario files don't depend on each other until vehicle references in trainsets are resolved,
+	// which happens on the main thread once both are available
+	vehicles_thread = std::thread(&scenery_scanner::scan_vehicles, this);
+	scenarios_thread = std::thread(&scenery_scanner::scan_scenarios, this);
+}
+
+bool scenery_scanner::scanning() const
+{
+	if (!bank_ready || !scenarios_done)
+		return true;
+	// scenarios scanned, but not yet adopted by the main thread
+	std::lock_guard<std::mutex> lock(scanned_scenarios.mutex);
+	return !scanned_scenarios.data.empty();
+}
 
-		if (*path.filename().string().begin() == '$')
-			continue;
+void scenery_scanner::update()
+{
+	std::vector<scenery_desc> scanned;
+	{
+		std::lock_guard<std::mutex> lock(scanned_scenarios.mutex);
+		scanned.swap(scanned_scenarios.data);
+	}
+	// scenarios arrive sorted, so they can be simply appended. they're shown right away, with trainsets resolved once the vehicles bank is ready
+	for (auto &desc : scanned) {
+		scenarios.emplace_back(std::move(desc));
+		if (bank_ready)
+			resolve_trainsets(scenarios.back());
+		add_category(scenarios.back());
+	}
+
+	if (!bank_ready) {
+		{
+			std::lock_guard<std::mutex> lock(scanned_bank.mutex);
+			if (!scanned_bank.data)
+				return;
+
+			bank = std::move(*scanned_bank.data);
+			scanned_bank.data.reset();
+			bank_ready = true;
+		}
+		// catch up with scenarios adopted before the bank
+		for (auto &desc : scenarios)
+			resolve_trainsets(desc);
+	}
+}
+
+void scenery_scanner::scan_vehicles()
+{
+	ui::vehicles_bank scanned;
+	try {
+		scanned.scan_textures();
+	}
+	catch (std::filesystem::filesystem_error const &error) {
+		ErrorLog(std::string("Bad file: failed to scan vehicle definitions, ") + error.what(), logtype::file);
+	}
+
+	std::lock_guard<std::mutex> lock(scanned_bank.mutex);
+	scanned_bank.data.emplace(std::move(scanned));
+}
+
+void scenery_scanner::scan_scenarios()
+{
+	std::vector<std::filesystem::path> paths;
+	try {
+		for (auto &f : std::filesystem::directory_iterator("scenery")) {
+			std::filesystem::path path(std::filesystem::relative(f.path(), "scenery/"));
+
+			if (*path.filename().string().begin() == '$')
+				continue;
+
+			if (path.string().ends_with(EU07_FILEEXTENSION_SCENARIO))
+				paths.emplace_back(path);
+		}
+	}
+	catch (std::filesystem::filesystem_error const &error) {
+		ErrorLog(std::string("Bad file: failed to scan scenario files, ") + error.what(), logtype::file);
+	}
+	std::sort(paths.begin(), paths.end());
+
+	std::map<std::filesystem::path, scenery_desc> index;
+	load_index(index);
+
+	std::vector<scenery_desc> scanned;
+	auto changed { index.size() != paths.size() };
+	for (auto const &path : paths) {
+		if (cancelled)
+			break;
+
+		auto const stamp { file_stamp("scenery/" + path.string()) };
+		auto lookup { index.find(path) };
+		if (lookup != index.end() && lookup->second.file_stamp == stamp) {
+			scanned.emplace_back(std::move(lookup->second));
+		}
+		else {
+			scanned.emplace_back(scan_scn(path));
+			scanned.back().file_stamp = stamp;
+			changed = true;
+		}
 
-		if (path.string().ends_with(".scn"))
-			scan_scn(path);
+		std::lock_guard<std::mutex> lock(scanned_scenarios.mutex);
+		scanned_scenarios.data.emplace_back(scanned.back());
 	}
 
-	std::sort(scenarios.begin(), scenarios.end(),
-	          [](const scenery_desc &a, const scenery_desc &b) { return a.path < b.path; });
+	if (changed && !cancelled)
+		save_index(scanned);
 
-	build_categories();
+	scenarios_done = true;
 }
 
-void scenery_scanner::scan_scn(std::filesystem::path path)
+scenery_desc scenery_scanner::scan_scn(std::filesystem::path path)
 {
-	scenarios.emplace_back();
-	scenery_desc &desc = scenarios.back();
+	scenery_desc desc;
 	desc.path = path;
 
 	std::string file_path = "scenery/" + path.string();
@@ -39,7 +162,7 @@ void scenery_scanner::scan_scn(std::filesystem::path path)
 	while (!parser.eof()) {
 		parser.getTokens();
 		if (parser.peek() == "trainset")
-			parse_trainset(parser);
+			parse_trainset(desc, parser);
 	}
 
 	std::ifstream stream(file_path, std::ios_base::binary | std::ios_base::in);
@@ -82,11 +205,12 @@ void scenery_scanner::scan_scn(std::filesystem::path path)
 			}
 		}
 	}
+
+	return desc;
 }
 
-void scenery_scanner::parse_trainset(cParser &parser)
+void scenery_scanner::parse_trainset(scenery_desc &desc, cParser &parser)
 {
-	scenery_desc &desc = scenarios.back();
 	desc.trainsets.emplace_back();
 	auto &trainset = desc.trainsets.back();
 
@@ -125,47 +249,179 @@ void scenery_scanner::parse_trainset(cParser &parser)
 		skinfile = ToLower(skinfile);
 		erase_extension(skinfile);
 		replace_slashes(datafolder);
-		auto vehicle_path = std::filesystem::path(ToLower(datafolder)) / ToLower(mmdfile);
+		dyn.vehicle_path = (std::filesystem::path(ToLower(datafolder)) / ToLower(mmdfile)).generic_string();
+		dyn.skin_name = skinfile;
 
-		auto it = bank.vehicles.find(vehicle_path);
-		if (it != bank.vehicles.end()) {
-			dyn.vehicle = it->second;
-			bool found = false;
+		parser.getTokens();
+		if (parser.peek() != "enddynamic") {
+			parser >> dyn.loadtype;
+			parser.getTokens();
+		}
+
+		parser.getTokens();
+	}
 
+	trainset.file_bounds.second = parser.Line();
+}
+
+void scenery_scanner::resolve_trainsets(scenery_desc &desc) const
+{
+	auto const file_path = "scenery/" + desc.path.string();
+
+	for (auto &trainset : desc.trainsets) {
+		for (auto &dyn : trainset.vehicles) {
+			auto it = bank.vehicles.find(dyn.vehicle_path);
+			if (it == bank.vehicles.end()) {
+				ErrorLog("vehicle type not found: " + dyn.vehicle_path + ", file: " + file_path, logtype::file);
+				continue;
+			}
+
+			dyn.vehicle = it->second;
 			for (const std::shared_ptr<ui::skin_set> &vehicle_skin : it->second->matching_skinsets) {
-				if (vehicle_skin->skin != skinfile)
+				if (vehicle_skin->skin != dyn.skin_name)
 					continue;
 
 				dyn.skin = vehicle_skin;
-				found = true;
 				break;
 			}
-			if (!found && skinfile != "none")
-				ErrorLog("skin not found: " + skinfile + ", vehicle type: " + vehicle_path.string() + ", file: " + parser.Name(), logtype::file);
+			if (!dyn.skin && dyn.skin_name != "none")
+				ErrorLog("skin not found: " + dyn.skin_name + ", vehicle type: " + dyn.vehicle_path + ", file: " + file_path, logtype::file);
 		}
-		else {
-			ErrorLog("vehicle type not found: " + vehicle_path.string() + ", file: " + parser.Name(), logtype::file);
+	}
+}
+
+void scenery_scanner::add_category(scenery_desc &desc)
+{
+	// If the scenario does have a category, add it to the list so we can render it later in a group.
+	if (!desc.category.empty())
+		categories[desc.category].push_back(&desc);
+}
+
+void scenery_scanner::load_index(std::map<std::filesystem::path, scenery_desc> &Index) const
+{
+	std::ifstream input(EU07_LAUNCHERINDEX, std::ios::binary);
+	if (!input.is_open())
+		return;
+
+	if (sn_utils::ld_uint32(input) != EU07_FILEHEADER
+	        || sn_utils::ld_uint32(input) != EU07_FILEVERSION_LAUNCHERINDEX) {
+		WriteLog("Bad file: \"" + EU07_LAUNCHERINDEX + "\" is of either unrecognized type or version");
+		return;
+	}
+
+	auto scenariocount { sn_utils::ld_uint32(input) };
+	while (scenariocount-- && input.good()) {
+		scenery_desc desc;
+		desc.path = sn_utils::d_str(input);
+		desc.file_stamp.first = sn_utils::ld_int64(input);
+		desc.file_stamp.second = sn_utils::ld_uint64(input);
+		desc.name = sn_utils::d_str(input);
+		desc.description = sn_utils::d_str(input);
+		desc.category = sn_utils::d_str(input);
+		desc.image_path = sn_utils::d_str(input);
+
+		auto linkcount { sn_utils::ld_uint32(input) };
+		while (linkcount-- && input.good()) {
+			auto file { sn_utils::d_str(input) };
+			auto label { sn_utils::d_str(input) };
+			desc.links.emplace_back(file, label);
 		}
 
-		parser.getTokens();
-		if (parser.peek() != "enddynamic") {
-			parser >> dyn.loadtype;
-			parser.getTokens();
+		auto trainsetcount { sn_utils::ld_uint32(input) };
+		while (trainsetcount-- && input.good()) {
+			auto &trainset { desc.trainsets.emplace_back() };
+			trainset.file_bounds.first = sn_utils::ld_int32(input);
+			trainset.file_bounds.second = sn_utils::ld_int32(input);
+			trainset.description = sn_utils::d_str(input);
+			trainset.name = sn_utils::d_str(input);
+			trainset.track = sn_utils::d_str(input);
+			trainset.offset = sn_utils::ld_float32(input);
+			trainset.velocity = sn_utils::ld_float32(input);
+
+			auto vehiclecount { sn_utils::ld_uint32(input) };
+			while (vehiclecount-- && input.good()) {
+				auto &dyn { trainset.vehicles.emplace_back() };
+				dyn.name = sn_utils::d_str(input);
+				dyn.drivertype = sn_utils::d_str(input);
+				dyn.offset = sn_utils::ld_float32(input);
+				dyn.loadtype = sn_utils::d_str(input);
+				dyn.loadcount = sn_utils::ld_int32(input);
+				dyn.coupling = sn_utils::ld_uint32(input);
+				dyn.params = sn_utils::d_str(input);
+				dyn.vehicle_path = sn_utils::d_str(input);
+				dyn.skin_name = sn_utils::d_str(input);
+			}
 		}
 
-		parser.getTokens();
+		if (!input.good())
+			break;
+
+		Index.emplace(desc.path, std::move(desc));
 	}
 
-	trainset.file_bounds.second = parser.Line();
+	if (!input.good()) {
+		// damaged index is simply rebuilt
+		WriteLog("Bad file: \"" + EU07_LAUNCHERINDEX + "\" is incomplete");
+		Index.clear();
+	}
 }
 
-void scenery_scanner::build_categories()
+void scenery_scanner::save_index(std::vector<scenery_desc> const &Scenarios) const
 {
-	for (auto &desc : scenarios) {
-		std::string name = desc.path.stem().string();
-		std::string prefix = desc.category;
-		// If the scenario does have a category, add it to the list so we can render it later in a group.
-		if (!prefix.empty())
-			categories[prefix].push_back(&desc);
+	// the index is written to a temporary file first, so interrupted write doesn't leave a damaged index behind
+	auto const temporary_path { EU07_LAUNCHERINDEX + ".tmp" };
+	std::ofstream output(temporary_path, std::ios::binary | std::ios::trunc);
+	if (!output.is_open())
+		return;
+
+	sn_utils::ls_uint32(output, EU07_FILEHEADER);
+	sn_utils::ls_uint32(output, EU07_FILEVERSION_LAUNCHERINDEX);
+
+	sn_utils::ls_uint32(output, Scenarios.size());
+	for (auto const &desc : Scenarios) {
+		sn_utils::s_str(output, desc.path.string());
+		sn_utils::ls_int64(output, desc.file_stamp.first);
+		sn_utils::ls_uint64(output, desc.file_stamp.second);
+		sn_utils::s_str(output, desc.name);
+		sn_utils::s_str(output, desc.description);
+		sn_utils::s_str(output, desc.category);
+		sn_utils::s_str(output, desc.image_path);
+
+		sn_utils::ls_uint32(output, desc.links.size());
+		for (auto const &link : desc.links) {
+			sn_utils::s_str(output, link.first);
+			sn_utils::s_str(output, link.second);
+		}
+
+		sn_utils::ls_uint32(output, desc.trainsets.size());
+		for (auto const &trainset : desc.trainsets) {
+			sn_utils::ls_int32(output, trainset.file_bounds.first);
+			sn_utils::ls_int32(output, trainset.file_bounds.second);
+			sn_utils::s_str(output, trainset.description);
+			sn_utils::s_str(output, trainset.name);
+			sn_utils::s_str(output, trainset.track);
+			sn_utils::ls_float32(output, trainset.offset);
+			sn_utils::ls_float32(output, trainset.velocity);
+
+			sn_utils::ls_uint32(output, trainset.vehicles.size());
+			for (auto const &dyn : trainset.vehicles) {
+				sn_utils::s_str(output, dyn.name);
+				sn_utils::s_str(output, dyn.drivertype);
+				sn_utils::ls_float32(output, dyn.offset);
+				sn_utils::s_str(output, dyn.loadtype);
+				sn_utils::ls_int32(output, dyn.loadcount);
+				sn_utils::ls_uint32(output, dyn.coupling);
+				sn_utils::s_str(output, dyn.params);
+				sn_utils::s_str(output, dyn.vehicle_path);
+				sn_utils::s_str(output, dyn.skin_name);
+			}
+		}
 	}
+
+	output.close();
+
+	std::error_code error;
+	std::filesystem::rename(temporary_path, EU07_LAUNCHERINDEX, error);
+	if (error)
+		ErrorLog("Bad file: failed to save launcher index \"" + EU07_LAUNCHERINDEX + "\"", logtype::file);
 }
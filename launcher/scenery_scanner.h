@@ -3,6 +3,7 @@
 #include <filesystem>
 #include "model/Texture.h"
 #include "utilities/parser.h"
+#include "utilities/utilities.h"
 #include "textures_scanner.h"
 
 struct dynamic_desc {
@@ -18,6 +19,9 @@ struct dynamic_desc {
 
 	std::shared_ptr<ui::vehicle_desc> vehicle;
 	std::shared_ptr<ui::skin_set> skin;
+	// vehicle type and skin as written in the scenario file, resolved against vehicles bank
+	std::string vehicle_path;
+	std::string skin_name;
 };
 
 struct trainset_desc {
@@ -36,6 +40,7 @@ struct trainset_desc {
 
 struct scenery_desc {
 	std::filesystem::path path;
+	std::pair<std::int64_t, std::uint64_t> file_stamp; // modification time and size of the file the data came from
 	std::string name;
 	std::string description;
 	std::string category;
@@ -53,19 +58,44 @@ struct scenery_desc {
 	}
 };
 
+// scans scenario files and vehicle definitions in the background.
+// scenario files are parsed only if they changed since the previous run, otherwise their content is taken from the index file
 class scenery_scanner {
 public:
 	scenery_scanner(ui::vehicles_bank &bank);
+	~scenery_scanner();
 
-	std::vector<scenery_desc> scenarios;
+	// deque keeps the scenarios in place as more of them are added
+	std::deque<scenery_desc> scenarios;
 	std::map<std::string, std::vector<scenery_desc*>> categories;
 
+	// starts the background scan
 	void scan();
+	// adopts results of the background scan. to be called by the main thread
+	void update();
+	// returns: true if the background scan is still in progress
+	bool scanning() const;
 
 private:
-	void scan_scn(std::filesystem::path path);
-	void parse_trainset(cParser &parser);
-	void build_categories();
+	// background work
+	void scan_vehicles();
+	void scan_scenarios();
+	scenery_desc scan_scn(std::filesystem::path path);
+	void parse_trainset(scenery_desc &desc, cParser &parser);
+	// index
+	void load_index(std::map<std::filesystem::path, scenery_desc> &Index) const;
+	void save_index(std::vector<scenery_desc> const &Scenarios) const;
+	// main thread
+	void resolve_trainsets(scenery_desc &desc) const;
+	void add_category(scenery_desc &desc);
 
 	ui::vehicles_bank &bank;
+	bool bank_ready { false };
+
+	threading::lockable<std::optional<ui::vehicles_bank>> scanned_bank;
+	mutable threading::lockable<std::vector<scenery_desc>> scanned_scenarios;
+	std::atomic<bool> scenarios_done { false };
+	std::atomic<bool> cancelled { false };
+	std::thread vehicles_thread;
+	std::thread scenarios_thread;
 };
@@ -3,10 +3,9 @@
 #include "rendering/renderer.h"
 #include "utilities/translation.h"
 
-ui::vehiclepicker_panel::vehiclepicker_panel()
-    : ui_panel(STR("Select vehicle"), false), placeholder_mini("textures/mini/other")
+ui::vehiclepicker_panel::vehiclepicker_panel(vehicles_bank &bank)
+    : ui_panel(STR("Select vehicle"), false), placeholder_mini("textures/mini/other"), bank(bank)
 {
-	bank.scan_textures();
 }
 
 void ui::vehiclepicker_panel::render_contents()
@@ -9,7 +9,7 @@ namespace ui {
 class vehiclepicker_panel : public ui_panel
 {
   public:
-	vehiclepicker_panel();
+	vehiclepicker_panel(vehicles_bank &bank);
 
 	void render_contents() override;
 
@@ -42,7 +42,7 @@ private:
 		{ vehicle_type::unknown, STRN("Unknown") }
 	};
 
-	vehicles_bank bank;
+	vehicles_bank &bank;
 
 	struct search_info
 	{
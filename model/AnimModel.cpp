@@ -25,7 +25,13 @@ http://mozilla.org/MPL/2.0/.
 #include "utilities/Logs.h"
 #include "rendering/renderer.h"
 
-std::list<std::weak_ptr<TAnimContainer>> TAnimModel::acAnimList;
+// NOTE: the list is never destroyed, as containers still active at exit deregister when model instances are deleted,
+// which happens during destruction of static objects in unspecified order
+std::vector<TAnimContainer *> &TAnimModel::acAnimList()
+{
+    static auto *activelist { new std::vector<TAnimContainer *>() };
+    return *activelist;
+}
 
 TAnimContainer::TAnimContainer()
 {
@@ -41,6 +47,11 @@ TAnimContainer::TAnimContainer()
 	evDone = nullptr; // powiadamianie o zakończeniu animacji
 }
 
+TAnimContainer::~TAnimContainer()
+{
+    Deactivate();
+}
+
 bool TAnimContainer::Init(TSubModel *pNewSubModel)
 {
     fRotateSpeed = 0.0f;
@@ -60,11 +71,7 @@ void TAnimContainer::SetRotateAnim(glm::vec3 vNewRotateAngles, double fNewRotate
     if (evDone)
     { // dołączyć model do listy aniomowania, żeby animacje były przeliczane również bez
         // wyświetlania
-        if (iAnim >= 0)
-        { // jeśli nie jest jeszcze na liście animacyjnej
-			TAnimModel::acAnimList.push_back(shared_from_this());
-			iAnim |= 0x80000000; // dodany do listy
-        }
+        Activate();
     }
 }
 
@@ -80,11 +87,7 @@ void TAnimContainer::SetTranslateAnim(glm::dvec3 vNewTranslate, double fNewSpeed
     if (evDone)
     { // dołączyć model do listy aniomowania, żeby animacje były przeliczane również bez
         // wyświetlania
-        if (iAnim >= 0)
-        { // jeśli nie jest jeszcze na liście animacyjnej
-			TAnimModel::acAnimList.push_back(shared_from_this());
-            iAnim |= 0x80000000; // dodany do listy
-        }
+        Activate();
     }
 }
 
@@ -234,6 +237,26 @@ bool TAnimContainer::InMovement()
     return fRotateSpeed != 0.0 || fTranslateSpeed != 0.0;
 }
 
+void TAnimContainer::Activate()
+{ // dołączenie do zbioru aktywnych animacji, o ile jeszcze nie jest w nim
+    if (iActive >= 0)
+        return;
+    auto &activelist { TAnimModel::acAnimList() };
+    iActive = static_cast<int>(activelist.size());
+    activelist.push_back(this);
+}
+
+void TAnimContainer::Deactivate()
+{ // usunięcie ze zbioru aktywnych animacji, ostatni element zajmuje zwolnione miejsce
+    if (iActive < 0)
+        return;
+    auto &activelist { TAnimModel::acAnimList() };
+    activelist[iActive] = activelist.back();
+    activelist[iActive]->iActive = iActive;
+    activelist.pop_back();
+    iActive = -1;
+}
+
 void TAnimContainer::EventAssign(basic_event *ev)
 { // przypisanie eventu wykonywanego po zakończeniu animacji
     evDone = ev;
@@ -688,15 +711,15 @@ void TAnimModel::SkinSet( int const Index, material_handle const Material ) {
 
 void TAnimModel::AnimUpdate(double dt)
 { // wykonanie zakolejkowanych animacji, nawet gdy modele nie są aktualnie wyświetlane
-	acAnimList.remove_if([](std::weak_ptr<TAnimContainer> ptr)
-	{
-		std::shared_ptr<TAnimContainer> container = ptr.lock();
-		if (!container)
-			return true;
-
-		container->UpdateModel(); // na razie bez usuwania z listy, bo głównie obrotnica na nią wchodzi
-		return false;
-	});
+    // iterate backwards, so the entries moved in place of the removed ones were already updated
+    auto &activelist { acAnimList() };
+    for (auto idx = static_cast<int>(activelist.size()) - 1; idx >= 0; --idx)
+    {
+        auto *container { activelist[idx] };
+        container->UpdateModel();
+        if (false == container->InMovement())
+            container->Deactivate(); // ruch zakończony, event został już zakolejkowany
+    }
 }
 
 // radius() subclass details, calculates node's bounding radius.
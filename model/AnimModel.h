@@ -46,7 +46,7 @@ class TAnimVocaloidFrame
 
 class basic_event;
 
-class TAnimContainer : std::enable_shared_from_this<TAnimContainer>
+class TAnimContainer
 { // opakowanie submodelu, określające animację egzemplarza - obsługiwane jako lista
     friend TAnimModel;
 
@@ -70,13 +70,17 @@ class TAnimContainer : std::enable_shared_from_this<TAnimContainer>
     // dla kinematyki odwróconej używane są kwaterniony
     float fLength; // długość kości dla IK
     int iAnim; // animacja: +1-obrót Eulera, +2-przesuw, +4-obrót kwaternionem, +8-IK
-    //+0x80000000: animacja z eventem, wykonywana poza wyświetlaniem
     //+0x100: pierwszy stopień IK - obrócić w stronę pierwszego potomnego (dziecka)
     //+0x200: drugi stopień IK - dostosować do pozycji potomnego potomnego (wnuka)
     basic_event *evDone; // ewent wykonywany po zakończeniu animacji, np. zapór, obrotnicy
+    int iActive { -1 }; // pozycja w zbiorze animacji przeliczanych poza wyświetlaniem, -1 gdy poza nim
+    // animacja z eventem jest przeliczana również poza wyświetlaniem, do czasu zakończenia ruchu
+    void Activate();
+    void Deactivate();
   public:
     // wyświetlania
 	TAnimContainer();
+    ~TAnimContainer();
     bool Init(TSubModel *pNewSubModel);
     inline
     std::string NameGet() {
@@ -166,8 +170,9 @@ public:
 // members
 	std::list<std::shared_ptr<TAnimContainer>> m_animlist;
 
-	// lista animacji z eventem, które muszą być przeliczane również bez wyświetlania
-	static std::list<std::weak_ptr<TAnimContainer>> acAnimList;
+	// zbiór animacji z eventem w ruchu, które muszą być przeliczane również bez wyświetlania
+	// NOTE: containers register themselves when their movement starts and leave once it's over
+	static std::vector<TAnimContainer *> &acAnimList();
 
 public:
 // methods
@@ -124,3 +124,25 @@ light_array::update() {
         }
     }
 }
+
+// collects most relevant lights for the viewer
+void
+light_array::select( glm::dvec3 const &Viewer, double const Range, std::size_t const Count, std::vector<light_record const *> &Output ) const {
+
+    Output.clear();
+    // weed out lights which are off or too far to matter...
+    auto const rangesquared { Range * Range };
+    for( auto const &light : data ) {
+        if( ( light.intensity != 0.f )
+         && ( glm::length2( light.position - Viewer ) <= rangesquared ) ) {
+            Output.emplace_back( &light );
+        }
+    }
+    // ...then put in order only as many of the remaining lights as the caller can use, preferring closer and/or brighter ones
+    auto const count { std::min( Count, Output.size() ) };
+    std::partial_sort(
+        std::begin( Output ), std::begin( Output ) + count, std::end( Output ),
+        [&Viewer]( light_record const *Left, light_record const *Right ) {
+            return ( glm::length2( Viewer - Left->position ) / Left->intensity ) < ( glm::length2( Viewer - Right->position ) / Right->intensity ); } );
+    Output.resize( count );
+}
@@ -34,6 +34,10 @@ public:
     // updates records in the collection
     void
         update();
+    // collects up to specified number of active lights within specified range from the viewer, most relevant first.
+    // relevance is based on distance and intensity of the light. order of the records in the collection is left intact
+    void
+        select( glm::dvec3 const &Viewer, double const Range, std::size_t const Count, std::vector<light_record const *> &Output ) const;
 
 // types
     typedef std::vector<light_record> lightrecord_array;
@@ -61,19 +61,20 @@ opengl33_particles::update( opengl_camera const &Camera ) {
 		// TODO: put sanity cap on the overall amount of particles that can be drawn
 		auto const sizestep { 256.0 * billboard_vertices.size() };
 		m_particlevertices.reserve(
-		    sizestep * std::ceil( m_particlevertices.size() + ( particles.size() * billboard_vertices.size() ) / sizestep ) );
-		for( auto const &particle : particles ) {
+		    sizestep * std::ceil( m_particlevertices.size() + ( particles.count() * billboard_vertices.size() ) / sizestep ) );
+		auto const origin { glm::vec3{ particles.origin - Camera.position() } };
+		for( std::size_t idx = 0; idx < particles.count(); ++idx ) {
 			// TODO: particle color support
 			vertex.color[ 0 ] = particlecolor.r;
 			vertex.color[ 1 ] = particlecolor.g;
 			vertex.color[ 2 ] = particlecolor.b;
-			vertex.color.a = std::clamp(particle.opacity, 0.0f, 1.0f);
+			vertex.color.a = std::clamp(particles.opacity[ idx ], 0.0f, 1.0f);
 
-			auto const offset { glm::vec3{ particle.position - Camera.position() } };
-			auto const rotation { glm::angleAxis( particle.rotation, glm::vec3{ 0.f, 0.f, 1.f } ) };
+			auto const offset { origin + particles.offset( idx ) };
+			auto const rotation { glm::angleAxis( particles.rotation[ idx ], glm::vec3{ 0.f, 0.f, 1.f } ) };
 
 			for( auto const &billboardvertex : billboard_vertices ) {
-				vertex.position = offset + ( rotation * billboardvertex.first * particle.size ) * camerarotation;
+				vertex.position = offset + ( rotation * billboardvertex.first * particles.size[ idx ] ) * camerarotation;
 				vertex.texture = billboardvertex.second;
 
 				m_particlevertices.emplace_back( vertex );
@@ -371,6 +371,14 @@ bool opengl33_renderer::Init(GLFWwindow *Window)
 
 void opengl33_renderer::Shutdown()
 {
+    // visibility jobs read the scene, don't leave them running past this point
+    for (auto *task : {&m_colorvisibility, &m_shadowvisibility[0], &m_shadowvisibility[1], &m_shadowvisibility[2]})
+    {
+        if (task->done.valid())
+        {
+            task->done.wait();
+        }
+    }
     vr.reset();
 }
 
@@ -555,6 +563,7 @@ std::unique_ptr<gl::program> opengl33_renderer::make_shader(std::string v, std::
 
 bool opengl33_renderer::Render()
 {
+	PROFILE_ZONE("render");
 	Timer::subsystem.gfx_total.start();
 
 	if (!Global.gfx_usegles)
@@ -746,6 +755,8 @@ void opengl33_renderer::Render_pass(viewport_config &vp, rendermode const Mode)
 		}
 
         m_colorpass = m_renderpass; // cache pass data
+        // resolve scene visibility for the pass while the gpu is busy with shadows and reflections
+        Cull_async(m_colorpass, m_colorvisibility);
 
 		scene_ubs.time = Timer::GetTime();
 		{
@@ -925,7 +936,7 @@ void opengl33_renderer::Render_pass(viewport_config &vp, rendermode const Mode)
 
 		model_ubs.future = future;
 
-		Render(simulation::Region);
+		Render(simulation::Region, &m_colorvisibility);
 
         Render_vr_models();
 
@@ -1114,13 +1125,21 @@ if (!Global.gfx_skippipeline)
         }
 
 
+        // pass setup doesn't involve the gfx api, so we can configure all stages up front and cull them in parallel
+        for( auto idx = 0; idx < m_shadowpass.size(); ++idx ) {
+            setup_pass( vp, m_shadowpass[ idx ], rendermode::shadows, csmstageboundaries[ idx ], csmstageboundaries[ idx + 1 ] );
+            if( m_shadowcolor != colors::white ) {
+                Cull_async( m_shadowpass[ idx ], m_shadowvisibility[ idx ] );
+            }
+        }
+
         for( auto idx = 0; idx < m_shadowpass.size(); ++idx ) {
 
             m_shadow_fb->attach( *m_shadow_tex, GL_DEPTH_ATTACHMENT, idx );
             m_shadow_fb->clear( GL_DEPTH_BUFFER_BIT );
 
-            setup_pass( vp, m_renderpass, rendermode::shadows, csmstageboundaries[ idx ], csmstageboundaries[ idx + 1 ] );
-            m_shadowpass[ idx ] = m_renderpass; // store pass config for reference in other stages
+            m_shadowpass[ idx ].draw_stats = m_renderpass.draw_stats;
+            m_renderpass = m_shadowpass[ idx ]; // switch to config of the current stage, carrying over accumulated stats
 
             setup_matrices();
             scene_ubs.projection = OpenGLMatrices.data( GL_PROJECTION );
@@ -1131,7 +1150,7 @@ if (!Global.gfx_skippipeline)
             scene_ubo->update( scene_ubs );
 
             if( m_shadowcolor != colors::white ) {
-                Render( simulation::Region );
+                Render( simulation::Region, &m_shadowvisibility[ idx ] );
                 if( idx > 0 ) { continue; } // render cab only in the closest csm stage
                 if( !FreeFlyModeFlag && Global.render_cab ) {
                     Render_cab( simulation::Train->Dynamic(), 0.0f, false );
@@ -2369,18 +2388,17 @@ void opengl33_renderer::Update_AnimModel(TAnimModel *model)
 	model->RaAnimate(m_framestamp);
 }
 
-void opengl33_renderer::Render(scene::basic_region *Region)
+void opengl33_renderer::Cull(scene::basic_region const &Region, renderpass_config const &Pass, section_sequence &Sections, cell_sequence &Cells)
 {
+	PROFILE_ZONE("culling");
 
-	m_sectionqueue.clear();
-	m_cellqueue.clear();
-	// discard last pass's accumulated instance buckets before this pass starts
-	m_frame_instance_buckets.clear();
+	Sections.clear();
+	Cells.clear();
 	// build a list of region sections to render
-	glm::vec3 const cameraposition{m_renderpass.pass_camera.position()};
+	glm::vec3 const cameraposition{Pass.pass_camera.position()};
 	auto const camerax = static_cast<int>(std::floor(cameraposition.x / scene::EU07_SECTIONSIZE + scene::EU07_REGIONSIDESECTIONCOUNT / 2));
 	auto const cameraz = static_cast<int>(std::floor(cameraposition.z / scene::EU07_SECTIONSIZE + scene::EU07_REGIONSIDESECTIONCOUNT / 2));
-	int const segmentcount = 2 * static_cast<int>(std::ceil(m_renderpass.draw_range * Global.fDistanceFactor / scene::EU07_SECTIONSIZE));
+	int const segmentcount = 2 * static_cast<int>(std::ceil(Pass.draw_range * Global.fDistanceFactor / scene::EU07_SECTIONSIZE));
 	int const originx = camerax - segmentcount / 2;
 	int const originz = cameraz - segmentcount / 2;
 
@@ -2404,32 +2422,98 @@ void opengl33_renderer::Render(scene::basic_region *Region)
 			{
 				break;
 			}
-			auto *section{Region->m_sections[row * scene::EU07_REGIONSIDESECTIONCOUNT + column]};
-			if ((section != nullptr) && (m_renderpass.pass_camera.visible(section->m_area)))
+			auto *section{Region.m_sections[row * scene::EU07_REGIONSIDESECTIONCOUNT + column]};
+			if ((section != nullptr) && (Pass.pass_camera.visible(section->m_area)))
 			{
-				m_sectionqueue.emplace_back(section);
+				Sections.emplace_back(section);
 			}
 		}
 	}
 
+	// build a list of the sections' cells to render
+	switch (Pass.draw_mode)
+	{
+	case rendermode::color:
+	case rendermode::shadows:
+	case rendermode::pickscenery:
+		break;
+	case rendermode::reflections:
+	{
+		// we can skip filling the cell queue if reflections pass isn't going to use it
+		if (Global.reflectiontune.fidelity == 0)
+		{
+			return;
+		}
+		break;
+	}
+	case rendermode::pickcontrols:
+	default:
+	{
+		return;
+	}
+	}
+	for (auto *section : Sections)
+	{
+		for (auto &cell : section->m_cells)
+		{
+			if ((true == cell.m_active) && (Pass.pass_camera.visible(cell.m_area)))
+			{
+				// store visible cells with content as well as their current distance, for sorting later
+				Cells.emplace_back(glm::length2(Pass.pass_camera.position() - cell.m_area.center), &cell);
+			}
+		}
+	}
+	if (Pass.draw_mode == rendermode::color)
+	{
+		// draw opaque cells front-to-back: with the depth test enabled this
+		// lets the GPU reject hidden fragments early, before the (expensive)
+		// lit fragment shader runs on them. Order is irrelevant to the final
+		// image for opaque geometry, so this is purely a fill-rate win.
+		std::sort( std::begin( Cells ), std::end( Cells ),
+			[]( distancecell_pair const &Left, distancecell_pair const &Right ) { return Left.first < Right.first; } );
+	}
+}
+
+void opengl33_renderer::Cull_async(renderpass_config const &Pass, visibility_task &Task)
+{
+	if (Task.done.valid())
+	{
+		// lists of the previous, unclaimed job can be still in use
+		Task.done.wait();
+	}
+	Task.done = m_cullworkers.submit([&Task, Pass]() {
+		Cull(*simulation::Region, Pass, Task.sections, Task.cells); });
+}
+
+void opengl33_renderer::Render(scene::basic_region *Region, visibility_task *Visibility)
+{
+
+	// discard last pass's accumulated instance buckets before this pass starts
+	m_frame_instance_buckets.clear();
+	if ((Visibility != nullptr) && (Visibility->done.valid()))
+	{
+		// lists were built in the background, swap them in and leave our old buffers for reuse by the next job
+		Visibility->done.get();
+		m_sectionqueue.swap(Visibility->sections);
+		m_cellqueue.swap(Visibility->cells);
+	}
+	else
+	{
+		Cull(*Region, m_renderpass, m_sectionqueue, m_cellqueue);
+	}
+
 	switch (m_renderpass.draw_mode)
 	{
 	case rendermode::color:
 	{
 		Render(std::begin(m_sectionqueue), std::end(m_sectionqueue));
-		// draw queue is filled while rendering sections
 		if (EditorModeFlag && m_current_viewport->main)
 		{
 			// when editor mode is active calculate world position of the cursor
 			// at this stage the z-buffer is filled with only ground geometry
             Update_Mouse_Position();
 		}
-		// draw opaque cells front-to-back: with the depth test enabled this
-		// lets the GPU reject hidden fragments early, before the (expensive)
-		// lit fragment shader runs on them. Order is irrelevant to the final
-		// image for opaque geometry, so this is purely a fill-rate win.
-		std::sort( std::begin( m_cellqueue ), std::end( m_cellqueue ),
-			[]( distancecell_pair const &Left, distancecell_pair const &Right ) { return Left.first < Right.first; } );
+		// cell queue is already sorted front-to-back
 		Render(std::begin(m_cellqueue), std::end(m_cellqueue));
 		break;
 	}
@@ -2516,44 +2600,6 @@ void opengl33_renderer::Render(section_sequence::iterator First, section_sequenc
 		}
 		}
 
-		// add the section's cells to the cell queue
-		switch (m_renderpass.draw_mode)
-		{
-		case rendermode::color:
-		case rendermode::shadows:
-        case rendermode::pickscenery:
-		{
-            // TBD, TODO: refactor into a method to reuse below?
-			for (auto &cell : section->m_cells)
-			{
-				if ((true == cell.m_active) && (m_renderpass.pass_camera.visible(cell.m_area)))
-				{
-					// store visible cells with content as well as their current distance, for sorting later
-					m_cellqueue.emplace_back(glm::length2(m_renderpass.pass_camera.position() - cell.m_area.center), &cell);
-				}
-			}
-			break;
-		}
-		case rendermode::reflections:
-        {
-            // we can skip filling the cell queue if reflections pass isn't going to use it
-            if( Global.reflectiontune.fidelity == 0 ) { break; }
-			for (auto &cell : section->m_cells)
-			{
-				if ((true == cell.m_active) && (m_renderpass.pass_camera.visible(cell.m_area)))
-				{
-					// store visible cells with content as well as their current distance, for sorting later
-					m_cellqueue.emplace_back(glm::length2(m_renderpass.pass_camera.position() - cell.m_area.center), &cell);
-				}
-			}
-			break;
-        }
-		case rendermode::pickcontrols:
-		default:
-		{
-			break;
-		}
-		}
 		// proceed to next section
 		++First;
 	}
@@ -5131,17 +5177,9 @@ void opengl33_renderer::Update_Lights(light_array &Lights)
 
     Bind_Texture( gl::HEADLIGHT_TEX, m_headlightstexture );
 
-	// arrange the light array from closest to farthest from current position of the camera
+	// pick the lights closest to current position of the camera. we don't care about lights past arbitrary limit of 1 km
 	auto const camera = m_colorpass.pass_camera.position();
-	std::sort(
-        std::begin(Lights.data), std::end(Lights.data),
-        [&camera](light_array::light_record const &Left, light_array::light_record const &Right) {
-		    // move lights which are off at the end...
-		    if (Left.intensity  == 0.f) { return false; }
-		    if (Right.intensity == 0.f) { return true; }
-		    // ...otherwise prefer closer and/or brigher light sources
-		    return (glm::length2(camera - Left.position) / Left.intensity) < (glm::length2(camera - Right.position) / Right.intensity);
-    	});
+	Lights.select(camera, 1000.0, m_lights.size(), m_selectedlights);
 
     // set up helpers
    	glm::mat4 coordmove;
@@ -5167,23 +5205,10 @@ void opengl33_renderer::Update_Lights(light_array &Lights)
     auto renderlight = m_lights.begin();
     size_t light_i = 1;
 
-    for (auto const &scenelight : Lights.data)
+    for (auto const *selectedlight : m_selectedlights)
 	{
-		if (renderlight == m_lights.end()) {
-			// we ran out of lights to assign
-			break;
-		}
-		if (scenelight.intensity == 0.f) {
-			// all lights past this one are bound to be off
-			break;
-		}
+		auto const &scenelight = *selectedlight;
 		auto const lightoffset = glm::vec3{scenelight.position - camera};
-		if (glm::length2(lightoffset) > sq(1000.f)) {
-			// we don't care about lights past arbitrary limit of 1 km.
-			// but there could still be weaker lights which are closer, so keep looking
-			continue;
-		}
-		// if the light passed tests so far, it's good enough
 		renderlight->position = lightoffset;
 		renderlight->direction = scenelight.direction;
 
@@ -30,6 +30,8 @@ http://mozilla.org/MPL/2.0/.
 #include "gl/pbo.h"
 #include "gl/query.h"
 
+#include <future>
+
 // bare-bones render controller, in lack of anything better yet
 class opengl33_renderer : public gfx_renderer {
   public:
@@ -190,6 +192,13 @@ class opengl33_renderer : public gfx_renderer {
 	using section_sequence = std::vector<scene::basic_section *>;
 	using distancecell_pair = std::pair<double, scene::basic_cell *>;
 	using cell_sequence = std::vector<distancecell_pair>;
+	// region sections and cells visible in a render pass, resolved ahead of the pass by a background job
+	struct visibility_task
+	{
+		section_sequence sections;
+		cell_sequence cells;
+		std::future<void> done;
+	};
 
 	struct renderpass_config
 	{
@@ -271,7 +280,12 @@ class opengl33_renderer : public gfx_renderer {
 	// creates dynamic environment cubemap
 	bool Render_reflections(viewport_config &vp);
 	bool Render(world_environment *Environment);
-	void Render(scene::basic_region *Region);
+	// collects region sections and cells visible in specified pass. touches only the scene and the pass camera, so it's safe to run off the render thread
+	static void Cull(scene::basic_region const &Region, renderpass_config const &Pass, section_sequence &Sections, cell_sequence &Cells);
+	// starts building visibility lists for specified pass in the background
+	void Cull_async(renderpass_config const &Pass, visibility_task &Task);
+	// renders the region using visibility lists from provided task, if there's one in progress, or from culling done on the spot
+	void Render(scene::basic_region *Region, visibility_task *Visibility = nullptr);
 	void Render(section_sequence::iterator First, section_sequence::iterator Last);
 	void Render(cell_sequence::iterator First, cell_sequence::iterator Last);
     void Render(scene::shape_node const &Shape, bool const Ignorerange);
@@ -328,6 +342,7 @@ class opengl33_renderer : public gfx_renderer {
 	texture_manager m_textures;
 	opengl33_light m_sunlight;
 	opengllight_array m_lights;
+	std::vector<light_array::light_record const *> m_selectedlights; // scene lights assigned to the light slots in current frame
 	/*
 	    float m_sunandviewangle; // cached dot product of sunlight and camera vectors
     */
@@ -372,6 +387,11 @@ class opengl33_renderer : public gfx_renderer {
 	renderpass_config m_renderpass; // parameters for current render pass
 	section_sequence m_sectionqueue; // list of sections in current render pass
 	cell_sequence m_cellqueue;
+	visibility_task m_colorvisibility; // visibility lists of the color pass, built while the shadow and reflection passes are rendered
+	std::array<visibility_task, 3> m_shadowvisibility; // visibility lists of csm stages
+	// persistent workers running the visibility jobs, enough for the color pass and all csm stages to be culled at once.
+	// declared after the tasks, so it's destroyed, finishing pending jobs, while the lists they fill still exist
+	threading::worker_pool m_cullworkers{std::clamp<std::size_t>(std::thread::hardware_concurrency(), 2, 5) - 1};
 	// frame-level accumulation of per-cell opaque instance buckets. Each visited
 	// cell's buckets are merged here keyed by (TModel3d*, skins), so that
 	// Render_Instanced() runs once per unique model across the whole pass instead
@@ -59,19 +59,20 @@ opengl_particles::update( opengl_camera const &Camera ) {
         // TODO: put sanity cap on the overall amount of particles that can be drawn
         auto const sizestep { 256.0 * billboard_vertices.size() };
         m_particlevertices.reserve(
-            sizestep * std::ceil( m_particlevertices.size() + ( particles.size() * billboard_vertices.size() ) / sizestep ) );
-        for( auto const &particle : particles ) {
+            sizestep * std::ceil( m_particlevertices.size() + ( particles.count() * billboard_vertices.size() ) / sizestep ) );
+        auto const origin { glm::vec3{ particles.origin - Camera.position() } };
+        for( std::size_t idx = 0; idx < particles.count(); ++idx ) {
             // TODO: particle color support
             vertex.color[ 0 ] = static_cast<std::uint_fast8_t>( particlecolor.r );
             vertex.color[ 1 ] = static_cast<std::uint_fast8_t>( particlecolor.g );
             vertex.color[ 2 ] = static_cast<std::uint_fast8_t>( particlecolor.b );
-            vertex.color[ 3 ] = static_cast<std::uint_fast8_t>( std::clamp( particle.opacity * 255, 0.f, 255.f ) );
+            vertex.color[ 3 ] = static_cast<std::uint_fast8_t>( std::clamp( particles.opacity[ idx ] * 255, 0.f, 255.f ) );
 
-            auto const offset { glm::vec3{ particle.position - Camera.position() } };
-            auto const rotation { glm::angleAxis( particle.rotation, glm::vec3{ 0.f, 0.f, 1.f } ) };
+            auto const offset { origin + particles.offset( idx ) };
+            auto const rotation { glm::angleAxis( particles.rotation[ idx ], glm::vec3{ 0.f, 0.f, 1.f } ) };
 
             for( auto const &billboardvertex : billboard_vertices ) {
-                vertex.position = offset + ( rotation * billboardvertex.first * particle.size ) * camerarotation;
+                vertex.position = offset + ( rotation * billboardvertex.first * particles.size[ idx ] ) * camerarotation;
                 vertex.texture = billboardvertex.second;
 
                 m_particlevertices.emplace_back( vertex );
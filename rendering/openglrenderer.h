@@ -286,6 +286,7 @@ private:
     texture_manager m_textures;
     opengl_light m_sunlight;
     opengllight_array m_lights;
+    std::vector<light_array::light_record const *> m_selectedlights; // scene lights assigned to the light slots in current frame
     opengl_skydome m_skydomerenderer;
     opengl_precipitation m_precipitationrenderer;
     opengl_particles m_particlerenderer; // particle visualization subsystem
@@ -156,12 +156,6 @@ smoke_source::bind( TAnimModel const *Node ) {
 void
 smoke_source::update( double const Timedelta, bool const Onlydespawn ) {
 
-    // prepare bounding box for new pass
-    // TODO: include bounding box in the bounding_area class
-    bounding_box boundingbox {
-        glm::dvec3{ std::numeric_limits<double>::max() },
-        glm::dvec3{ std::numeric_limits<double>::lowest() } };
-
     m_spawncount = (
         ( ( false == Global.Smoke ) || ( true == Onlydespawn ) ) ?
             0.f :
@@ -209,80 +203,75 @@ smoke_source::update( double const Timedelta, bool const Onlydespawn ) {
 			}
 		}
 	}
-    
-    // update spawned particles
-    for( auto particleiterator { std::begin( m_particles ) }; particleiterator != std::end( m_particles ); ++particleiterator ) {
 
-        auto &particle { *particleiterator };
-        bool particleisalive;
+    if( true == m_particles.empty() ) {
+        // with no particles to convert, keep the sequence origin close to the source
+        m_particles.origin = location();
+    }
+    auto const constants { update_constants_for( Timedelta ) };
 
-        while( ( false == ( particleisalive = update( particle, boundingbox, Timedelta ) ) )
-            && ( m_spawncount >= 1.f ) ) {
-            // replace dead particle with a new one
-            m_spawncount -= 1.f;
-            initialize( particle );
-        }
-        if( false == particleisalive ) {
-            // we have a dead particle and no pending spawn requests, (try to) move the last particle here
-            do {
-                if( std::next( particleiterator ) == std::end( m_particles ) ) { break; } // already at last particle
-                particle = m_particles.back();
-                m_particles.pop_back();
-            } while( false == ( particleisalive = update( particle, boundingbox, Timedelta ) ) );
-        }
-        if( false == particleisalive ) {
-            // NOTE: if we're here it means the iterator is at last container slot which holds a dead particle about to be eliminated...
-            m_particles.pop_back();
-            // ...since this effectively makes the iterator now point at end() and the advancement at the end of the loop will move it past end()
-            // we have to break the loop manually (could use < comparison but with both ways being ugly, this is 
-            break;
+    // update spawned particles
+    update( 0, m_particles.count(), constants );
+    // replace dead particles with new ones, or if there's no pending spawn requests fill their slots with the last particles in the sequence
+    for( std::size_t idx = 0; idx < m_particles.count(); ) {
+        if( ( m_particles.opacity[ idx ] > 0.f )
+         || ( true == spawn( idx, constants ) ) ) {
+            ++idx;
+            continue;
         }
+        // NOTE: the last particle was already updated during this pass, the slot is re-checked without advancing
+        m_particles.move_back( idx );
     }
     // spawn pending particles in remaining container slots
     while( ( m_spawncount >= 1.f )
-        && ( m_particles.size() < m_max_particles ) ) {
+        && ( m_particles.count() < m_max_particles ) ) {
 
         m_spawncount -= 1.f;
-        // work with a temporary copy in case initial update renders the particle dead
-        smoke_particle newparticle;
-        initialize( newparticle );
-        if( true == update( newparticle, boundingbox, Timedelta ) ) {
-            // if the new particle didn't die immediately place it in the container...
-            m_particles.emplace_back( newparticle );
-        }
+        spawn( constants );
     }
     // if we still have pending requests after filling entire container replace older particles
     if( m_spawncount >= 1.f ) {
-        // sort all particles from most to least transparent, oldest to youngest if it's a tie
-        std::sort(
-            std::begin( m_particles ),
-            std::end( m_particles ),
-            []( smoke_particle const &Left, smoke_particle const &Right ) {
-                return ( Left.opacity != Right.opacity ?
-                            Left.opacity < Right.opacity :
-                            Left.age > Right.age ); } );
+        // pick particles from most to least transparent, oldest to youngest if it's a tie
+        // each replaced particle takes at least one spawn request, so only that many candidates need to be ordered
+        std::vector<std::size_t> candidates( m_particles.count() );
+        std::iota( std::begin( candidates ), std::end( candidates ), 0 );
+        auto const candidatecount { std::min<std::size_t>( candidates.size(), static_cast<std::size_t>( m_spawncount ) ) };
+        auto const &opacity { m_particles.opacity };
+        auto const &age { m_particles.age };
+        std::partial_sort(
+            std::begin( candidates ),
+            std::begin( candidates ) + candidatecount,
+            std::end( candidates ),
+            [&]( std::size_t const Left, std::size_t const Right ) {
+                return ( opacity[ Left ] != opacity[ Right ] ?
+                            opacity[ Left ] < opacity[ Right ] :
+                            age[ Left ] > age[ Right ] ); } );
         // replace old particles with new ones until we run out of either requests or room
-        for( auto &particle : m_particles ) {
-
-            while( m_spawncount >= 1.f ) {
-                m_spawncount -= 1.f;
-                // work with a temporary copy so we don't wind up with replacing a good particle with a dead on arrival one
-                smoke_particle newparticle;
-                initialize( newparticle );
-                if( true == update( newparticle, boundingbox, Timedelta ) ) {
-                    // if the new particle didn't die immediately place it in the container...
-                    particle = newparticle;
-                    // ...and move on to the next slot
-                    break;
-                }
-            }
+        for( std::size_t idx = 0; ( idx < candidatecount ) && ( m_spawncount >= 1.f ); ++idx ) {
+            spawn( candidates[ idx ], constants );
         }
         // discard pending spawn requests our container couldn't fit
         m_spawncount -= std::floor( m_spawncount );
     }
-    // determine bounding area from calculated bounding box
+    // determine bounding area from bounding box of owned particles
     if( false == m_particles.empty() ) {
-		m_area.center = glm::mix(boundingbox[value_limit::min], boundingbox[value_limit::max], 0.5);
+        glm::vec3 boundingbox[ 2 ] {
+            glm::vec3{ std::numeric_limits<float>::max() },
+            glm::vec3{ std::numeric_limits<float>::lowest() } };
+        auto const *size { m_particles.size.data() };
+        auto const count { m_particles.count() };
+        for( int component = 0; component < 3; ++component ) {
+            auto const *position { m_particles.position[ component ].data() };
+            auto minvalue { std::numeric_limits<float>::max() };
+            auto maxvalue { std::numeric_limits<float>::lowest() };
+            for( std::size_t idx = 0; idx < count; ++idx ) {
+                minvalue = std::min( minvalue, position[ idx ] - size[ idx ] );
+                maxvalue = std::max( maxvalue, position[ idx ] + size[ idx ] );
+            }
+            boundingbox[ value_limit::min ][ component ] = minvalue;
+            boundingbox[ value_limit::max ][ component ] = maxvalue;
+        }
+        m_area.center = m_particles.origin + glm::dvec3{ glm::mix( boundingbox[ value_limit::min ], boundingbox[ value_limit::max ], 0.5f ) };
         m_area.radius = 0.5 * ( glm::length( boundingbox[ value_limit::max ] - boundingbox[ value_limit::min ] ) );
     }
     else {
@@ -328,8 +317,6 @@ smoke_source::initialize( smoke_particle &Particle ) {
 
     m_emitter.initialize( Particle );
 
-    Particle.position = location();
-
     if( m_ownertype == owner_type::vehicle ) {
         Particle.opacity *= m_owner.vehicle->MoverParameters->dizel_fill;
         auto const enginerevolutionsfactor { 1.5f }; // high engine revolutions increase initial particle velocity
@@ -356,46 +343,143 @@ smoke_source::initialize( smoke_particle &Particle ) {
     }
 }
 
-// updates state of provided particle and bounding box. returns: true if particle is still alive afterwards, false otherwise
-bool
-smoke_source::update( smoke_particle &Particle, bounding_box &Boundingbox, double const Timedelta ) {
-
-    m_opacitymodifier.update( Particle.opacity, Timedelta );
-    // if the particle is dead we can bail out early...
-    if( Particle.opacity <= 0.f ) { return false; }
-    // ... otherwise proceed with full update
-    m_sizemodifier.update( Particle.size, Timedelta );
+// calculates values shared by all particles for current update pass
+smoke_source::update_constants
+smoke_source::update_constants_for( double const Timedelta ) const {
 
+    update_constants constants;
+    constants.timedelta = Timedelta;
+    constants.spawnoffset = glm::vec3{ location() - m_particles.origin };
+    constants.drift = 0.1f * simulation::Environment.wind() * static_cast<float>( Timedelta );
     // crude smoke dispersion simulation
     // http://www.auburn.edu/academic/forestry_wildlife/fire/smoke_guide/smoke_dispersion.htm
-	switch (m_ownertype)
-	{
-	case owner_type::vehicle:
-	{
-    Particle.velocity.y += ( 0.025 * Particle.velocity.y ) * std::min( 0.f, Global.AirTemperature - 90 ) * Timedelta; // decelerate faster in cold weather
-	Particle.velocity.y -= ( (0.05 * (pow(m_owner.vehicle->GetVelocity()*1,0.4))) * Particle.velocity.y ) * Global.Overcast * Timedelta; // decelerate faster with high air humidity and/or precipitation
-	break;
+    switch( m_ownertype ) {
+        case owner_type::vehicle: {
+            auto const coldfactor { 1.0 + 0.025 * std::min( 0.f, Global.AirTemperature - 90 ) * Timedelta }; // decelerate faster in cold weather
+            auto const humidityfactor { 1.0 - 0.05 * std::pow( m_owner.vehicle->GetVelocity(), 0.4 ) * Global.Overcast * Timedelta }; // decelerate faster with high air humidity and/or precipitation
+            constants.velocityfactor = static_cast<float>( coldfactor * humidityfactor );
+            constants.velocityfloor = std::numeric_limits<float>::lowest();
+            break;
+        }
+        default: {
+            auto const coldfactor { 1.0 + 0.005 * std::min( 0.f, Global.AirTemperature - 10 ) * Timedelta }; // decelerate faster in cold weather
+            auto const humidityfactor { 1.0 - 0.050 * Global.Overcast * Timedelta }; // decelerate faster with high air humidity and/or precipitation
+            constants.velocityfactor = static_cast<float>( coldfactor * humidityfactor );
+            constants.velocityfloor = 0.25f * ( 2.f - Global.Overcast ); // put a cap on deceleration
+            break;
+        }
     }
-	default:
-	{
-	Particle.velocity.y += ( 0.005 * Particle.velocity.y ) * std::min( 0.f, Global.AirTemperature - 10 ) * Timedelta; // decelerate faster in cold weather
-    Particle.velocity.y -= ( 0.050 * Particle.velocity.y ) * Global.Overcast * Timedelta; // decelerate faster with high air humidity and/or precipitation
-    Particle.velocity.y = std::max<float>( 0.25 * ( 2.f - Global.Overcast ), Particle.velocity.y ); // put a cap on deceleration
-	break;
+
+    return constants;
+}
+
+// updates state of particles in specified range of the sequence
+// NOTE: dead particles receive full update as well, it's cheaper than branching and they're discarded afterwards anyway
+void
+smoke_source::update( std::size_t const First, std::size_t const Last, update_constants const &Constants ) {
+
+    if( First >= Last ) { return; }
+
+    auto const count { Last - First };
+    auto const timedelta { static_cast<float>( Constants.timedelta ) };
+
+    m_opacitymodifier.update( m_particles.opacity.data() + First, count, Constants.timedelta );
+    m_sizemodifier.update( m_particles.size.data() + First, count, Constants.timedelta );
+
+    auto *velocityy { m_particles.velocity[ 1 ].data() + First };
+    for( std::size_t idx = 0; idx < count; ++idx ) {
+        velocityy[ idx ] = std::max( velocityy[ idx ] * Constants.velocityfactor, Constants.velocityfloor );
     }
+    auto const *age { m_particles.age.data() + First };
+    for( int component = 0; component < 3; ++component ) {
+        auto *position { m_particles.position[ component ].data() + First };
+        auto const *velocity { m_particles.velocity[ component ].data() + First };
+        auto const drift { Constants.drift[ component ] };
+        for( std::size_t idx = 0; idx < count; ++idx ) {
+            position[ idx ] += velocity[ idx ] * timedelta + drift * age[ idx ];
+        }
     }
-    
-    Particle.position += Particle.velocity * static_cast<float>( Timedelta );
-    Particle.position += 0.1f * Particle.age * simulation::Environment.wind() * static_cast<float>( Timedelta );
-//    m_velocitymodifier.update( Particle.velocity, Timedelta );
+    auto *particleage { m_particles.age.data() + First };
+    for( std::size_t idx = 0; idx < count; ++idx ) {
+        particleage[ idx ] += timedelta;
+    }
+}
 
-    Particle.age += Timedelta;
+// adds new particle at the end of the sequence. returns: true if particle is still alive after its initial update, false (and discards it) otherwise
+bool
+smoke_source::spawn( update_constants const &Constants ) {
 
-    // update bounding box
-    Boundingbox[ value_limit::min ] = glm::min( Boundingbox[ value_limit::min ], Particle.position - glm::dvec3{ Particle.size } );
-    Boundingbox[ value_limit::max ] = glm::max( Boundingbox[ value_limit::max ], Particle.position + glm::dvec3{ Particle.size } );
+    smoke_particle particle;
+    initialize( particle );
+    particle.position = Constants.spawnoffset;
+    m_particles.push_back( particle );
 
-    return true;
+    auto const index { m_particles.count() - 1 };
+    update( index, index + 1, Constants );
+    if( m_particles.opacity[ index ] > 0.f ) {
+        return true;
+    }
+    m_particles.pop_back();
+    return false;
+}
+
+// replaces particle in specified slot with a new one, using pending spawn requests. returns: true on success, false if all requests produced dead particles
+bool
+smoke_source::spawn( std::size_t const Index, update_constants const &Constants ) {
+
+    while( m_spawncount >= 1.f ) {
+        m_spawncount -= 1.f;
+        // work with a temporary slot so we don't wind up with replacing a good particle with a dead on arrival one
+        if( true == spawn( Constants ) ) {
+            m_particles.move_back( Index );
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+smoke_source::particle_sequence::push_back( smoke_particle const &Particle ) {
+
+    for( int component = 0; component < 3; ++component ) {
+        position[ component ].emplace_back( Particle.position[ component ] );
+        velocity[ component ].emplace_back( Particle.velocity[ component ] );
+    }
+    rotation.emplace_back( Particle.rotation );
+    size.emplace_back( Particle.size );
+    opacity.emplace_back( Particle.opacity );
+    age.emplace_back( Particle.age );
+}
+
+void
+smoke_source::particle_sequence::pop_back() {
+
+    for( int component = 0; component < 3; ++component ) {
+        position[ component ].pop_back();
+        velocity[ component ].pop_back();
+    }
+    rotation.pop_back();
+    size.pop_back();
+    opacity.pop_back();
+    age.pop_back();
+}
+
+// moves the last particle in the sequence to specified slot, discarding its current content
+void
+smoke_source::particle_sequence::move_back( std::size_t const Index ) {
+
+    auto const last { count() - 1 };
+    if( Index != last ) {
+        for( int component = 0; component < 3; ++component ) {
+            position[ component ][ Index ] = position[ component ][ last ];
+            velocity[ component ][ Index ] = velocity[ component ][ last ];
+        }
+        rotation[ Index ] = rotation[ last ];
+        size[ Index ] = size[ last ];
+        opacity[ Index ] = opacity[ last ];
+        age[ Index ] = age[ last ];
+    }
+    pop_back();
 }
 
 
@@ -21,7 +21,7 @@ http://mozilla.org/MPL/2.0/.
 // -- size increased over time
 struct smoke_particle {
 
-    glm::dvec3 position; // meters, 3d space;
+    glm::vec3 position; // meters, 3d space; relative to the source particle sequence origin
     float rotation; // radians; local z axis angle
     glm::vec3 velocity; // meters per second, 3d space; current velocity
     float size; // multiplier, billboard size
@@ -48,6 +48,9 @@ public:
     // updates state of provided variable
     void
         update( Type_ &Variable, double const Timedelta ) const;
+    // updates state of provided sequence of variables
+    void
+        update( Type_ *Variables, std::size_t const Count, double const Timedelta ) const;
     void
         bind( Type_ const *Modifier ) {
             m_valuechangemodifier = Modifier; }
@@ -80,7 +83,36 @@ class smoke_source {
 
 public:
 // types
-    using particle_sequence = std::vector<smoke_particle>;
+    // owned particles. each attribute is kept in a separate array, so the update passes can be vectorized
+    struct particle_sequence {
+
+        glm::dvec3 origin; // meters, 3d space; reference point for particle positions
+        std::vector<float> position[ 3 ]; // meters, 3d space; relative to the origin
+        std::vector<float> velocity[ 3 ]; // meters per second, 3d space; current velocity
+        std::vector<float> rotation; // radians; local z axis angle
+        std::vector<float> size; // multiplier, billboard size
+        std::vector<float> opacity; // 0-1 range
+        std::vector<float> age; // seconds; time elapsed since creation
+
+        std::size_t
+            count() const {
+                return age.size(); }
+        bool
+            empty() const {
+                return age.empty(); }
+        // position of specified particle relative to the origin
+        glm::vec3
+            offset( std::size_t const Index ) const {
+                return { position[ 0 ][ Index ], position[ 1 ][ Index ], position[ 2 ][ Index ] }; }
+        // appends provided particle to the sequence
+        void
+            push_back( smoke_particle const &Particle );
+        void
+            pop_back();
+        // moves the last particle in the sequence to specified slot, discarding its current content
+        void
+            move_back( std::size_t const Index );
+    };
 // methods
     bool
         deserialize( cParser &Input );
@@ -125,7 +157,14 @@ private:
         void initialize( smoke_particle &Particle );
     };
 
-    using bounding_box = glm::dvec3[ 2 ]; // bounding box of owned particles
+    // values shared by all particles during single update pass
+    struct update_constants {
+        double timedelta; // seconds
+        glm::vec3 spawnoffset; // meters, 3d space; position of new particles relative to the sequence origin
+        float velocityfactor; // multiplier applied to vertical velocity
+        float velocityfloor; // lower limit of vertical velocity
+        glm::vec3 drift; // meters per second of particle age; wind-driven displacement
+    };
 
 // methods
     // imports member data pair from the config file
@@ -133,9 +172,18 @@ private:
         deserialize_mapping( cParser &Input );
     void
         initialize( smoke_particle &Particle );
-    // updates state of provided particle and bounding box. returns: true if particle is still alive afterwards, false otherwise
+    // calculates values shared by all particles for current update pass
+    update_constants
+        update_constants_for( double const Timedelta ) const;
+    // updates state of particles in specified range of the sequence
+    void
+        update( std::size_t const First, std::size_t const Last, update_constants const &Constants );
+    // adds new particle at the end of the sequence. returns: true if particle is still alive after its initial update, false (and discards it) otherwise
+    bool
+        spawn( update_constants const &Constants );
+    // replaces particle in specified slot with a new one, using pending spawn requests. returns: true on success, false if all requests produced dead particles
     bool
-        update( smoke_particle &Particle, bounding_box &Boundingbox, double const Timedelta );
+        spawn( std::size_t const Index, update_constants const &Constants );
 // members
     // config/inputs
     // TBD: union and indicator, or just plain owner variables?
@@ -219,6 +267,18 @@ fixedstep_modifier<Type_>::update( Type_ &Variable, double const Timedelta ) con
     Variable = glm::min( Variable, m_valuelimits[ value_limit::max ] );
 }
 
+template <typename Type_>
+void
+fixedstep_modifier<Type_>::update( Type_ *Variables, std::size_t const Count, double const Timedelta ) const {
+
+    auto const valuechange { value_change() * static_cast<float>( Timedelta ) };
+    auto const minvalue { m_valuelimits[ value_limit::min ] };
+    auto const maxvalue { m_valuelimits[ value_limit::max ] };
+    for( std::size_t idx = 0; idx < Count; ++idx ) {
+        Variables[ idx ] = glm::min( glm::max( Variables[ idx ] + valuechange, minvalue ), maxvalue );
+    }
+}
+
 template <typename Type_>
 void
 fixedstep_modifier<Type_>::deserialize( cParser &Input ) {
@@ -0,0 +1,187 @@
+/*
+This Source Code Form is subject to the
+terms of the Mozilla Public License, v.
+2.0. If a copy of the MPL was not
+distributed with this file, You can
+obtain one at
+http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstdint>
+
+namespace scene {
+
+// loose quadtree of items with circular bounds on the xz plane.
+// the tree is built in one go from complete set of items, and subdivided only where the items are dense.
+// each item is held by the smallest node which contains its center and is large enough to hold its bounds,
+// allowing loose node bounds twice the size of the node
+template <class Type_>
+class basic_quadtree {
+
+public:
+// methods
+    // removes all items from the tree
+    void
+        clear() {
+            m_items.clear();
+            m_nodes.clear();
+            m_order.clear(); }
+    // adds provided item to the set of items. the item becomes visible to queries after the tree is (re)built
+    void
+        insert( Type_ Item, glm::dvec3 const &Center, float const Radius ) {
+            m_items.push_back( { Item, { Center.x, Center.z }, Radius } ); }
+    // arranges added items into tree structure
+    void
+        build();
+    // calls provided visitor with items whose bounds overlap specified circle.
+    // NOTE: items are reported in tree traversal order, not in the order of insertion
+    template <class Visitor_>
+    void
+        query( glm::dvec3 const &Point, float const Radius, Visitor_ Visitor ) const;
+    // returns: number of items placed in the tree
+    std::size_t
+        size() const {
+            return m_items.size(); }
+    bool
+        empty() const {
+            return m_items.empty(); }
+
+private:
+// types
+    struct item {
+        Type_ value;
+        glm::dvec2 center;
+        float radius;
+    };
+    struct node {
+        glm::dvec2 center;
+        double halfsize;
+        std::uint32_t first { 0 }; // first item index held by the node, in m_order
+        std::uint32_t count { 0 }; // number of items held by the node
+        std::int32_t children { -1 }; // index of the first of four consecutive child nodes, or -1 for leaf nodes
+    };
+// methods
+    void
+        subdivide( std::size_t const Nodeindex, std::vector<std::uint32_t> &Items, int const Depth );
+// members
+    std::vector<item> m_items;
+    std::vector<node> m_nodes;
+    std::vector<std::uint32_t> m_order; // item indices, grouped by owning node
+    static std::size_t const m_nodecapacity { 8 }; // nodes holding more items than that are subdivided
+    static int const m_maxdepth { 8 };
+};
+
+template <class Type_>
+void
+basic_quadtree<Type_>::build() {
+
+    m_nodes.clear();
+    m_order.clear();
+    if( m_items.empty() ) { return; }
+
+    // nominal bounds of the root node enclose bounds of all items
+    glm::dvec2 areamin { m_items.front().center };
+    glm::dvec2 areamax { areamin };
+    for( auto const &item : m_items ) {
+        areamin = glm::min( areamin, item.center - glm::dvec2( item.radius ) );
+        areamax = glm::max( areamax, item.center + glm::dvec2( item.radius ) );
+    }
+    auto &root { m_nodes.emplace_back() };
+    root.center = 0.5 * ( areamin + areamax );
+    root.halfsize = std::max( 0.5 * std::max( areamax.x - areamin.x, areamax.y - areamin.y ), 1.0 );
+
+    std::vector<std::uint32_t> items( m_items.size() );
+    for( std::uint32_t idx = 0; idx < items.size(); ++idx ) {
+        items[ idx ] = idx;
+    }
+    m_order.reserve( m_items.size() );
+    subdivide( 0, items, 0 );
+}
+
+template <class Type_>
+void
+basic_quadtree<Type_>::subdivide( std::size_t const Nodeindex, std::vector<std::uint32_t> &Items, int const Depth ) {
+
+    auto const center { m_nodes[ Nodeindex ].center };
+    auto const childhalfsize { m_nodes[ Nodeindex ].halfsize * 0.5 };
+    // items which wouldn't fit in any of the children stay with the node
+    std::array<std::vector<std::uint32_t>, 4> childitems;
+    std::vector<std::uint32_t> ownitems;
+    auto const itemcount { Items.size() };
+    auto const split { ( itemcount > m_nodecapacity ) && ( Depth < m_maxdepth ) };
+    if( true == split ) {
+        for( auto const itemindex : Items ) {
+            auto const &item { m_items[ itemindex ] };
+            if( item.radius > childhalfsize ) {
+                ownitems.emplace_back( itemindex );
+                continue;
+            }
+            childitems[ ( item.center.x >= center.x ? 1 : 0 ) + ( item.center.y >= center.y ? 2 : 0 ) ].emplace_back( itemindex );
+        }
+    }
+    else {
+        ownitems.swap( Items );
+    }
+
+    m_nodes[ Nodeindex ].first = static_cast<std::uint32_t>( m_order.size() );
+    m_nodes[ Nodeindex ].count = static_cast<std::uint32_t>( ownitems.size() );
+    m_order.insert( std::end( m_order ), std::begin( ownitems ), std::end( ownitems ) );
+
+    if( ( false == split )
+     || ( ownitems.size() == itemcount ) ) {
+        // either a leaf, or none of the items fit in the children
+        return;
+    }
+    auto const firstchild { m_nodes.size() };
+    m_nodes[ Nodeindex ].children = static_cast<std::int32_t>( firstchild );
+    for( int child = 0; child < 4; ++child ) {
+        auto &childnode { m_nodes.emplace_back() };
+        childnode.center = center + glm::dvec2{ ( child & 1 ) ? childhalfsize : -childhalfsize, ( child & 2 ) ? childhalfsize : -childhalfsize };
+        childnode.halfsize = childhalfsize;
+    }
+    for( int child = 0; child < 4; ++child ) {
+        subdivide( firstchild + child, childitems[ child ], Depth + 1 );
+    }
+}
+
+template <class Type_>
+template <class Visitor_>
+void
+basic_quadtree<Type_>::query( glm::dvec3 const &Point, float const Radius, Visitor_ Visitor ) const {
+
+    if( m_nodes.empty() ) { return; }
+
+    glm::dvec2 const point { Point.x, Point.z };
+    std::int32_t stack[ 4 * m_maxdepth + 4 ];
+    int stacksize { 0 };
+    stack[ stacksize++ ] = 0;
+
+    while( stacksize > 0 ) {
+        auto const &node { m_nodes[ stack[ --stacksize ] ] };
+        // loose bounds of the node are twice its nominal size
+        auto const reach { 2.0 * node.halfsize + Radius };
+        if( ( std::abs( point.x - node.center.x ) > reach )
+         || ( std::abs( point.y - node.center.y ) > reach ) ) {
+            continue;
+        }
+        for( auto idx { node.first }; idx < node.first + node.count; ++idx ) {
+            auto const &item { m_items[ m_order[ idx ] ] };
+            if( glm::length2( item.center - point ) <= ( item.radius + Radius ) * ( item.radius + Radius ) ) {
+                Visitor( item.value );
+            }
+        }
+        if( node.children >= 0 ) {
+            for( int child = 0; child < 4; ++child ) {
+                stack[ stacksize++ ] = node.children + child;
+            }
+        }
+    }
+}
+
+} // scene
+
+//---------------------------------------------------------------------------
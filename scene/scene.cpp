@@ -28,6 +28,92 @@ std::string const EU07_FILEEXTENSION_REGION { ".sbt" };
 std::uint32_t const EU07_FILEHEADER { MAKE_ID4( 'E','U','0','7' ) };
 std::uint32_t const EU07_FILEVERSION_REGION { MAKE_ID4( 'S', 'B', 'T', '2' ) };
 std::map<std::string, basic_node *> Hierarchy;
+
+namespace {
+
+// directories smaller than that are searched linearly
+std::size_t const EU07_LOOKUPINDEXTHRESHOLD { 16 };
+// distance within which end points are considered for a match. matching tests themselves are stricter
+float const EU07_LOOKUPENDPOINTRANGE { 0.05f };
+// distance a vehicle can be placed from the path it's registered with
+float const EU07_LOOKUPVEHICLERANGE { 50.f };
+
+thread_local std::vector<std::uint32_t> LookupCandidates;
+
+// checks whether specified traction piece is within reach of the pantograph, and assigns it to the pantograph if it's the best match so far.
+// returns: true if the piece was assigned within width of the pantograph head, false if it was assigned within reach of the horns or not at all
+bool
+test_traction( TDynamicObject *Vehicle, TAnimPant *pantograph, glm::dvec3 const &pantographposition, TTraction *traction ) {
+
+	auto const vFront = Vehicle->VectorFront(); // wektor normalny dla płaszczyzny ruchu pantografu
+	auto const vUp = Vehicle->VectorUp(); // wektor pionu pudła (pochylony od pionu na przechyłce)
+	auto const vLeft = Vehicle->VectorLeft(); // wektor odległości w bok (odchylony od poziomu na przechyłce)
+
+    // współczynniki równania parametrycznego
+    auto const paramfrontdot = glm::dot( traction->vParametric, vFront );
+    auto const fRaParam =
+        -( glm::dot( traction->pPoint1, vFront ) - glm::dot( pantographposition, vFront ) )
+        / ( paramfrontdot != 0.0 ?
+                paramfrontdot :
+                0.001 ); // div0 trap
+
+    if( fRaParam < -0.001
+     || fRaParam > 1.001 ) { return false; }
+    // jeśli tylko jest w przedziale, wyznaczyć odległość wzdłuż wektorów vUp i vLeft
+    // punkt styku płaszczyzny z drutem (dla generatora łuku el.)
+    auto const vStyk = traction->pPoint1 + fRaParam * traction->vParametric;
+    // wektor musi się mieścić w przedziale ruchu pantografu
+    auto const vGdzie = vStyk - pantographposition;
+    auto fVertical = glm::dot( vGdzie, vUp );
+    if( fVertical >= 0.0 ) {
+        // jeśli ponad pantografem (bo może łapać druty spod wiaduktu)
+        auto const fHorizontal = std::abs( glm::dot( vGdzie, vLeft ) ) - pantograph->fWidth;
+
+        if (Global.bEnableTraction
+         && fVertical < pantograph->PantWys - 0.15 ) {
+            // jeśli drut jest niżej niż 15cm pod ślizgiem przełączamy w tryb połamania, o ile jedzie;
+            // (bEnableTraction) aby dało się jeździć na koślawych sceneriach
+            // i do tego jeszcze wejdzie pod ślizg
+            if( fHorizontal <= 0.0 ) {
+                // 0.635 dla AKP-1 AKP-4E
+                SetFlag( Vehicle->MoverParameters->DamageFlag, dtrain_pantograph );
+                pantograph->PantWys = -1.0; // ujemna liczba oznacza połamanie
+                pantograph->hvPowerWire = nullptr; // bo inaczej się zasila w nieskończoność z połamanego
+                if( Vehicle->MoverParameters->EnginePowerSource.CollectorParameters.CollectorsNo > 0 ) {
+                    // liczba pantografów teraz będzie mniejsza
+                    --Vehicle->MoverParameters->EnginePowerSource.CollectorParameters.CollectorsNo;
+                }
+                ErrorLog( "Bad traction: " + Vehicle->name() + " broke pantograph at " + to_string( pantographposition ), logtype::traction );
+
+            }
+        }
+        else if( fVertical < pantograph->PantTraction ) {
+            // ale niżej, niż poprzednio znaleziony
+            if( fHorizontal <= 0.0 ) {
+                // 0.635 dla AKP-1 AKP-4E
+                // to się musi mieścić w przedziale zaleznym od szerokości pantografu
+                pantograph->hvPowerWire = traction; // jakiś znaleziony
+                pantograph->PantTraction = fVertical; // zapamiętanie nowej wysokości
+                return true;
+            }
+            else if( fHorizontal < pantograph->fWidthExtra ) {
+                // czy zmieścił się w zakresie nabieżnika? problem jest, gdy nowy drut jest wyżej,
+                // wtedy pantograf odłącza się od starego, a na podniesienie do nowego potrzebuje czasu
+                // korekta wysokości o nabieżnik - drut nad nabieżnikiem jest geometrycznie jakby nieco wyżej
+                fVertical += 0.15 * fHorizontal / pantograph->fWidthExtra;
+                if( fVertical < pantograph->PantTraction ) {
+                    // gdy po korekcie jest niżej, niż poprzednio znaleziony
+                    // gdyby to wystarczyło, to możemy go uznać
+                    pantograph->hvPowerWire = traction; // może być
+                    pantograph->PantTraction = fVertical; // na razie liniowo na nabieżniku, dokładność poprawi się później
+                }
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace
  
 // potentially activates event handler with the same name as provided node, and within handler activation range
 void
@@ -55,67 +141,7 @@ basic_cell::update_traction( TDynamicObject *Vehicle, int const Pantographindex
     auto const pantographposition = position + vLeft * pantograph->vPos.z + vUp * pantograph->vPos.y + vFront * pantograph->vPos.x;
 
     for( auto *traction : m_directories.traction ) {
-
-        // współczynniki równania parametrycznego
-        auto const paramfrontdot = glm::dot( traction->vParametric, vFront );
-        auto const fRaParam =
-            -( glm::dot( traction->pPoint1, vFront ) - glm::dot( pantographposition, vFront ) )
-            / ( paramfrontdot != 0.0 ?
-                    paramfrontdot :
-                    0.001 ); // div0 trap
-
-        if( fRaParam < -0.001
-         || fRaParam > 1.001 ) { continue; }
-        // jeśli tylko jest w przedziale, wyznaczyć odległość wzdłuż wektorów vUp i vLeft
-        // punkt styku płaszczyzny z drutem (dla generatora łuku el.)
-        auto const vStyk = traction->pPoint1 + fRaParam * traction->vParametric;
-        // wektor musi się mieścić w przedziale ruchu pantografu
-        auto const vGdzie = vStyk - pantographposition;
-        auto fVertical = glm::dot( vGdzie, vUp );
-        if( fVertical >= 0.0 ) {
-            // jeśli ponad pantografem (bo może łapać druty spod wiaduktu)
-            auto const fHorizontal = std::abs( glm::dot( vGdzie, vLeft ) ) - pantograph->fWidth;
-
-            if (Global.bEnableTraction
-             && fVertical < pantograph->PantWys - 0.15 ) {
-                // jeśli drut jest niżej niż 15cm pod ślizgiem przełączamy w tryb połamania, o ile jedzie;
-                // (bEnableTraction) aby dało się jeździć na koślawych sceneriach
-                // i do tego jeszcze wejdzie pod ślizg
-                if( fHorizontal <= 0.0 ) {
-                    // 0.635 dla AKP-1 AKP-4E
-                    SetFlag( Vehicle->MoverParameters->DamageFlag, dtrain_pantograph );
-                    pantograph->PantWys = -1.0; // ujemna liczba oznacza połamanie
-                    pantograph->hvPowerWire = nullptr; // bo inaczej się zasila w nieskończoność z połamanego
-                    if( Vehicle->MoverParameters->EnginePowerSource.CollectorParameters.CollectorsNo > 0 ) {
-                        // liczba pantografów teraz będzie mniejsza
-                        --Vehicle->MoverParameters->EnginePowerSource.CollectorParameters.CollectorsNo;
-                    }
-                    ErrorLog( "Bad traction: " + Vehicle->name() + " broke pantograph at " + to_string( pantographposition ), logtype::traction );
-
-                }
-            }
-            else if( fVertical < pantograph->PantTraction ) {
-                // ale niżej, niż poprzednio znaleziony
-                if( fHorizontal <= 0.0 ) {
-                    // 0.635 dla AKP-1 AKP-4E
-                    // to się musi mieścić w przedziale zaleznym od szerokości pantografu
-                    pantograph->hvPowerWire = traction; // jakiś znaleziony
-                    pantograph->PantTraction = fVertical; // zapamiętanie nowej wysokości
-                }
-                else if( fHorizontal < pantograph->fWidthExtra ) {
-                    // czy zmieścił się w zakresie nabieżnika? problem jest, gdy nowy drut jest wyżej,
-                    // wtedy pantograf odłącza się od starego, a na podniesienie do nowego potrzebuje czasu
-                    // korekta wysokości o nabieżnik - drut nad nabieżnikiem jest geometrycznie jakby nieco wyżej
-                    fVertical += 0.15 * fHorizontal / pantograph->fWidthExtra;
-                    if( fVertical < pantograph->PantTraction ) {
-                        // gdy po korekcie jest niżej, niż poprzednio znaleziony
-                        // gdyby to wystarczyło, to możemy go uznać
-                        pantograph->hvPowerWire = traction; // może być
-                        pantograph->PantTraction = fVertical; // na razie liniowo na nabieżniku, dokładność poprawi się później
-                    }
-                }
-            }
-        }
+        test_traction( Vehicle, pantograph, pantographposition, traction );
     }
 }
 
@@ -326,6 +352,7 @@ basic_cell::insert( TTrack *Path ) {
 
     Path->origin( m_area.center );
     m_paths.emplace_back( Path );
+    m_directories.indexed = false;
     // animation hook
     Path->RaOwnerSet( this );
     // re-calculate cell radius, in case track extends outside the cell's boundaries
@@ -487,6 +514,7 @@ basic_cell::register_end( TTrack *Path ) {
             std::begin( m_directories.paths ),
             std::end( m_directories.paths ) ),
         std::end( m_directories.paths ) );
+    m_directories.indexed = false;
 }
 
 // registers provided traction piece in the lookup directory of the cell
@@ -500,6 +528,72 @@ basic_cell::register_end( TTraction *Traction ) {
             std::begin( m_directories.traction ),
             std::end( m_directories.traction ) ),
         std::end( m_directories.traction ) );
+    m_directories.indexed = false;
+}
+
+// builds spatial indices of the paths and traction pieces held by the cell
+void
+basic_cell::create_lookup_index() {
+
+    auto &directories { m_directories };
+    directories.pathends.clear();
+    directories.tractionends.clear();
+    directories.pathareas.clear();
+    directories.movablepaths.clear();
+
+    if( directories.paths.size() > EU07_LOOKUPINDEXTHRESHOLD ) {
+        for( std::uint32_t idx = 0; idx < directories.paths.size(); ++idx ) {
+            auto *path { directories.paths[ idx ] };
+            if( path->eType == tt_Table ) {
+                // turntable end points change as it rotates
+                directories.movablepaths.emplace_back( idx );
+                continue;
+            }
+            for( auto const &point : path->endpoints() ) {
+                directories.pathends.insert( idx, point, 0.f );
+            }
+        }
+        directories.pathends.build();
+    }
+    if( directories.traction.size() > EU07_LOOKUPINDEXTHRESHOLD ) {
+        for( std::uint32_t idx = 0; idx < directories.traction.size(); ++idx ) {
+            for( auto const &point : directories.traction[ idx ]->endpoints() ) {
+                directories.tractionends.insert( idx, point, 0.f );
+            }
+        }
+        directories.tractionends.build();
+    }
+    if( m_paths.size() > EU07_LOOKUPINDEXTHRESHOLD ) {
+        for( auto *path : m_paths ) {
+            directories.pathareas.insert( path, path->location(), path->radius() );
+        }
+        directories.pathareas.build();
+    }
+
+    directories.indexed = true;
+}
+
+// collects sorted indices of directory items with an end point located near specified point, and items with movable end points.
+// returns: false if the directory isn't indexed and has to be searched in whole
+bool
+basic_cell::find_candidates( glm::dvec3 const &Point, basic_quadtree<std::uint32_t> const &Index, std::vector<std::uint32_t> const &Movable, std::vector<std::uint32_t> &Candidates ) const {
+
+    if( ( false == m_directories.indexed )
+     || ( true == Index.empty() ) ) {
+        return false;
+    }
+    Candidates.clear();
+    Index.query(
+        Point, EU07_LOOKUPENDPOINTRANGE,
+        [&]( std::uint32_t const Item ) {
+            Candidates.emplace_back( Item ); } );
+    Candidates.insert( std::end( Candidates ), std::begin( Movable ), std::end( Movable ) );
+    // keep the order of the directory, so the results match these of linear search
+    std::sort( std::begin( Candidates ), std::end( Candidates ) );
+    Candidates.erase(
+        std::unique( std::begin( Candidates ), std::end( Candidates ) ),
+        std::end( Candidates ) );
+    return true;
 }
 
 // find a vehicle located nearest to specified point, within specified radius, optionally ignoring vehicles without drivers. reurns: located vehicle and distance
@@ -511,8 +605,8 @@ basic_cell::find( glm::dvec3 const &Point, float const Radius, bool const Onlyco
     float distance;
     float const distancecutoff { Radius * Radius }; // we'll ignore vehicles farther than this
 
-    for( auto *path : m_paths ) {
-        for( auto *vehicle : path->Dynamics ) {
+    auto const checkpath = [&]( TTrack const *Path ) {
+        for( auto *vehicle : Path->Dynamics ) {
             if( true == Onlycontrolled
              && vehicle->Mechanik == nullptr ) {
                 continue;
@@ -533,6 +627,19 @@ basic_cell::find( glm::dvec3 const &Point, float const Radius, bool const Onlyco
             }
             std::tie( vehiclenearest, leastdistance ) = std::tie( vehicle, distance );
         }
+    };
+
+    if( ( true == m_directories.indexed )
+     && ( false == m_directories.pathareas.empty() ) ) {
+        // dense cell, check only paths near the point of interest
+        m_directories.pathareas.query(
+            Point, Radius + EU07_LOOKUPVEHICLERANGE,
+            checkpath );
+    }
+    else {
+        for( auto *path : m_paths ) {
+            checkpath( path );
+        }
     }
     return { vehiclenearest, leastdistance };
 }
@@ -542,6 +649,21 @@ std::tuple<TTrack *, int>
 basic_cell::find( glm::dvec3 const &Point, TTrack const *Exclude ) const {
     int endpointid;
 
+    auto &candidates { LookupCandidates };
+    if( true == find_candidates( Point, m_directories.pathends, m_directories.movablepaths, candidates ) ) {
+        for( auto const idx : candidates ) {
+            auto *path { m_directories.paths[ idx ] };
+            if( path == Exclude ) { continue; }
+
+            endpointid = path->TestPoint( &Point );
+            if( endpointid >= 0 ) {
+
+                return { path, endpointid };
+            }
+        }
+        return { nullptr, -1 };
+    }
+
     for( auto *path : m_directories.paths ) {
 
         if( path == Exclude ) { continue; }
@@ -561,6 +683,21 @@ basic_cell::find( glm::dvec3 const &Point, TTraction const *Exclude ) const {
 
     int endpointid;
 
+    auto &candidates { LookupCandidates };
+    if( true == find_candidates( Point, m_directories.tractionends, {}, candidates ) ) {
+        for( auto const idx : candidates ) {
+            auto *traction { m_directories.traction[ idx ] };
+            if( traction == Exclude ) { continue; }
+
+            endpointid = traction->TestPoint( Point );
+            if( endpointid >= 0 ) {
+
+                return { traction, endpointid };
+            }
+        }
+        return { nullptr, -1 };
+    }
+
     for( auto *traction : m_directories.traction ) {
 
         if( traction == Exclude ) { continue; }
@@ -952,6 +1089,15 @@ basic_section::center( glm::dvec3 Center ) {
     }
 }
 
+// builds spatial indices of lookup directories in the cells of the section
+void
+basic_section::create_lookup_index() {
+
+    for( auto &cell : m_cells ) {
+        cell.create_lookup_index();
+    }
+}
+
 // generates renderable version of held non-instanced geometry
 void
 basic_section::create_geometry() {
@@ -1084,6 +1230,39 @@ basic_region::update_traction( TDynamicObject *Vehicle, int const Pantographinde
     auto p = Vehicle->pants[ Pantographindex ].fParamPants;
     auto const pant0 = position + vLeft * p->vPos.z + vUp * p->vPos.y + vFront * p->vPos.x;
     p->PantTraction = std::numeric_limits<double>::max(); // taka za duża wartość
+    auto const pantographintact { p->PantWys >= 0.0 };
+
+    // traction pieces assigned to paths under the vehicle and their neighbours cover the reach of the pantographs,
+    // the area search is only needed if these don't provide a wire above the pantograph head, e.g. for paths added after the scenario was loaded
+    std::array<TTrack *, 6> paths {};
+    std::size_t pathcount { 0 };
+    auto const addpath = [&]( TTrack *Path ) {
+        if( ( Path == nullptr )
+         || ( std::find( std::begin( paths ), std::begin( paths ) + pathcount, Path ) != std::begin( paths ) + pathcount ) ) {
+            return; }
+        paths[ pathcount++ ] = Path; };
+    for( auto *path : { Vehicle->Axle0.GetTrack(), Vehicle->Axle1.GetTrack() } ) {
+        if( path == nullptr ) { continue; }
+        addpath( path );
+        addpath( path->trPrev );
+        addpath( path->trNext );
+    }
+    auto incontact { false }; // whether current match is within width of the pantograph head
+    for( std::size_t idx = 0; idx < pathcount; ++idx ) {
+        for( auto *traction : paths[ idx ]->m_traction ) {
+            auto const *match { p->hvPowerWire };
+            auto const contact { test_traction( Vehicle, p, pant0, traction ) };
+            if( p->hvPowerWire != match ) {
+                incontact = contact;
+            }
+        }
+    }
+    if( ( ( p->hvPowerWire != nullptr ) && ( true == incontact ) )
+     || ( ( true == pantographintact ) && ( p->PantWys < 0.0 ) ) ) {
+        // found a wire above the pantograph head, or broke the pantograph trying
+        return;
+    }
+    // wires caught only by the horns can be beaten by a lower wire, which the area search also tests
 
     auto const &sectionlist = sections( pant0, EU07_CELLSIZE * 0.5 );
     for( auto *section : sectionlist ) {
@@ -1423,8 +1602,11 @@ basic_region::find_path( glm::dvec3 const &Point, TTrack const *Exclude ) {
 
     // TBD: throw out of bounds exception instead of checks all over the place..?
     if( point_inside( Point ) ) {
-
-        return section( Point ).find( Point, Exclude );
+        // the lookup doesn't create missing sections, so the linking passes can perform it concurrently
+        auto *section { find_section( Point ) };
+        if( section != nullptr ) {
+            return section->find( Point, Exclude );
+        }
     }
 
     return { nullptr, -1 };
@@ -1436,8 +1618,11 @@ basic_region::find_traction( glm::dvec3 const &Point, TTraction const *Exclude )
 
     // TBD: throw out of bounds exception instead of checks all over the place..?
     if( point_inside( Point ) ) {
-
-        return section( Point ).find( Point, Exclude );
+        // the lookup doesn't create missing sections, so the linking passes can perform it concurrently
+        auto *section { find_section( Point ) };
+        if( section != nullptr ) {
+            return section->find( Point, Exclude );
+        }
     }
 
     return { nullptr, -1 };
@@ -1470,6 +1655,17 @@ basic_region::find_traction( glm::dvec3 const &Point, TTraction const *Other, in
     return { tractionnearest, endpointnearest };
 }
 
+// builds spatial indices of lookup directories in the region
+void
+basic_region::create_lookup_index() {
+
+    for( auto *section : m_sections ) {
+        if( section != nullptr ) {
+            section->create_lookup_index();
+        }
+    }
+}
+
 // finds sections inside specified sphere. returns: list of sections
 std::vector<basic_section *> const &
 basic_region::sections( glm::dvec3 const &Point, float const Radius ) {
@@ -1713,6 +1909,19 @@ basic_region::section( glm::dvec3 const &Location ) {
     return *section;
 }
 
+// provides access to section enclosing specified point, without creating it if it doesn't exist. returns: the section or nullptr
+basic_section *
+basic_region::find_section( glm::dvec3 const &Location ) const {
+
+    auto const column { static_cast<int>( std::floor( Location.x / EU07_SECTIONSIZE + EU07_REGIONSIDESECTIONCOUNT / 2 ) ) };
+    auto const row    { static_cast<int>( std::floor( Location.z / EU07_SECTIONSIZE + EU07_REGIONSIDESECTIONCOUNT / 2 ) ) };
+
+    return
+        m_sections[
+              std::clamp( row,    0, EU07_REGIONSIDESECTIONCOUNT - 1 ) * EU07_REGIONSIDESECTIONCOUNT
+            + std::clamp( column, 0, EU07_REGIONSIDESECTIONCOUNT - 1 ) ];
+}
+
 void basic_region::create_map_geometry()
 {
     m_map_geometrybank = GfxRenderer->Create_Bank();
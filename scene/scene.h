@@ -20,6 +20,7 @@ http://mozilla.org/MPL/2.0/.
 #include "utilities/parser.h"
 #include "rendering/geometrybank.h"
 #include "scene/scenenode.h"
+#include "scene/quadtree.h"
 #include "world/Track.h"
 #include "world/Traction.h"
 #include "audio/sound.h"
@@ -145,6 +146,9 @@ public:
     // registers provided traction piece in the lookup directory of the cell
     void
         register_end( TTraction *Traction );
+    // builds spatial indices of the paths and traction pieces held by the cell, to speed up lookups in densely filled cells
+    void
+        create_lookup_index();
     // removes provided model instance from the cell
     void
         erase( TAnimModel *Instance );
@@ -217,6 +221,10 @@ public:
 	    launch_event(TEventLauncher *Launcher, bool local_only);
     void
         enclose_area( scene::basic_node *Node );
+    // collects sorted indices of directory items with an end point located near specified point, and items with movable end points.
+    // returns: false if the directory isn't indexed and has to be searched in whole
+    bool
+        find_candidates( glm::dvec3 const &Point, basic_quadtree<std::uint32_t> const &Index, std::vector<std::uint32_t> const &Movable, std::vector<std::uint32_t> &Candidates ) const;
 // members
     scene::bounding_area m_area { glm::dvec3(), static_cast<float>( 0.5 * M_SQRT2 * EU07_CELLSIZE ) };
     bool m_active { false }; // whether the cell holds any actual data content
@@ -238,6 +246,12 @@ public:
     struct lookup_data {
         path_sequence paths;
         traction_sequence traction;
+        // spatial indices, built once the content of the cell is complete. they hold indices into matching item sequences
+        bool indexed { false }; // false if the indices are missing or outdated
+        basic_quadtree<std::uint32_t> pathends; // end points of the paths in the directory
+        basic_quadtree<std::uint32_t> tractionends; // end points of the traction pieces in the directory
+        basic_quadtree<TTrack *> pathareas; // bounding areas of the paths placed in the cell
+        std::vector<std::uint32_t> movablepaths; // directory paths with variable end points, not covered by the index
     } m_directories;
     // animation of owned items (legacy code, clean up along with track refactoring)
     bool m_geometrycreated { false };
@@ -323,6 +337,9 @@ public:
     // sets center point of the section
     void
         center( glm::dvec3 Center );
+    // builds spatial indices of lookup directories in the cells of the section
+    void
+        create_lookup_index();
 	// generates renderable version of held non-instanced geometry
     void
         create_geometry();
@@ -447,6 +464,9 @@ public:
     // finds a traction piece located nearest to specified point, sharing section with specified other piece and powered in specified direction. returns: located traction piece
     std::tuple<TTraction *, int>
         find_traction( glm::dvec3 const &Point, TTraction const *Other, int const Currentdirection );
+    // builds spatial indices of lookup directories in the region. nodes added afterwards are found with (slower) linear search
+    void
+        create_lookup_index();
     // finds sections inside specified sphere. returns: list of sections
     std::vector<basic_section *> const &
         sections( glm::dvec3 const &Point, float const Radius );
@@ -484,6 +504,9 @@ public:
 	// provides access to section enclosing specified point
 	basic_section &
 	    section( glm::dvec3 const &Location );
+    // provides access to section enclosing specified point, without creating it if it doesn't exist. returns: the section or nullptr
+    basic_section *
+        find_section( glm::dvec3 const &Location ) const;
 
 // members
     section_array m_sections;
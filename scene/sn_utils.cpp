@@ -91,8 +91,8 @@ std::string sn_utils::d_str(std::istream &s)
 	char buf[1];
 	while (true)
 	{
-		s.read(buf, 1);
-		if (buf[0] == 0)
+		// stop at the end of data too, in case the string is truncated
+		if (!s.read(buf, 1) || buf[0] == 0)
 			break;
 		r.push_back(buf[0]);
 	}
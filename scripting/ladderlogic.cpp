@@ -73,13 +73,88 @@ basic_controller::load( std::string const &Filename ) -> bool {
     m_updateaccumulator = 0.0;
 
     m_programfilename = Filename;
-    cParser input( m_programfilename, cParser::buffer_FILE );
-    bool result { false };
-    while( true == deserialize_operation( input ) ) {
-        result = true; // once would suffice but, eh
+
+    return compile( *fetch_source( m_programfilename ) );
+}
+
+auto
+basic_controller::fetch_source( std::string const &Filename ) -> std::shared_ptr<source_sequence const> {
+
+    std::error_code error;
+    auto const timestamp { std::filesystem::last_write_time( Filename, error ) };
+    if( !error ) {
+        std::lock_guard<std::mutex> lock( m_sourcecachelock );
+        auto const lookup { m_sourcecache.find( Filename ) };
+        if( ( lookup != m_sourcecache.end() )
+         && ( lookup->second.timestamp == timestamp ) ) {
+            return lookup->second.source;
+        }
+    }
+    auto source { std::make_shared<source_sequence>() };
+    cParser input( Filename, cParser::buffer_FILE );
+    while( true == deserialize_operation( input, *source ) ) {
+        ; // deserialized operations are appended to the source
+    }
+    if( !error ) {
+        // edited programs replace the cached version for controllers loading them afterwards
+        std::lock_guard<std::mutex> lock( m_sourcecachelock );
+        m_sourcecache[ Filename ] = { timestamp, source };
+    }
+
+    return source;
+}
+
+auto
+basic_controller::compile( source_sequence const &Source ) -> bool {
+
+    m_program.clear();
+    m_program.reserve( Source.size() );
+    // ld(i) pops the stack or not depending on the results of earlier rungs, so we can only track the upper bound of its depth.
+    // still, an operation which lacks operands even at the upper bound is certain to fail, and can be reported and dropped here
+    auto stackdepth { 0 };
+    auto stackdepthmax { 0 };
+    for( auto const &source : Source ) {
+        // elements are created even for dropped instructions, so element handles don't depend on validity of the program
+        operation operation = { source.code, 0, source.parameter1, 0, source.line };
+        if( false == source.element.empty() ) {
+            operation.element =
+                find_or_insert(
+                    source.element,
+                    guess_element_type_from_name( source.element ) );
+        }
+
+        switch( source.code ) {
+            case opcode_e::op_ld:
+            case opcode_e::op_ldi: {
+                ++stackdepth;
+                break;
+            }
+            case opcode_e::op_anb:
+            case opcode_e::op_orb: {
+                if( stackdepth < 2 ) {
+                    log_error( "attempted " + ToUpper( source.mnemonic ) + " with empty stack", source.line );
+                    continue;
+                }
+                --stackdepth;
+                break;
+            }
+            default: {
+                if( stackdepth == 0 ) {
+                    log_error( "attempted " + ToUpper( source.mnemonic ) + " with empty accumulator", source.line );
+                    continue;
+                }
+                break;
+            }
+        }
+        stackdepthmax = std::max( stackdepthmax, stackdepth );
+
+        m_program.emplace_back( operation );
     }
 
-    return result;
+    m_accumulator.clear();
+    m_accumulator.reserve( stackdepthmax );
+
+    return ( false == Source.empty() );
 }
 
 auto
@@ -111,6 +186,9 @@ basic_controller::update( double const Timestep ) -> int {
     return run();
 }
 
+std::mutex basic_controller::m_sourcecachelock;
+std::unordered_map<std::string, basic_controller::cached_source> basic_controller::m_sourcecache;
+
 std::map<std::string, basic_controller::opcode_e> const basic_controller::m_operationcodemap = {
     { "ld", opcode_e::op_ld }, { "ldi", opcode_e::op_ldi },
     { "and", opcode_e::op_and }, { "ani", opcode_e::op_ani }, { "anb", opcode_e::op_anb },
@@ -120,12 +198,12 @@ std::map<std::string, basic_controller::opcode_e> const basic_controller::m_oper
 };
 
 auto
-basic_controller::deserialize_operation( cParser &Input ) -> bool {
+basic_controller::deserialize_operation( cParser &Input, source_sequence &Output ) -> bool {
 
     auto operationdata{ Input.getToken<std::string>( true, "\n\r" ) };
     if( true == operationdata.empty() ) { return false; }
 
-    operation operation = { opcode_e::op_nop, 0, 0, 0 };
+    source_operation operation = { opcode_e::op_nop, "", "", 0, Input.Line() - 1 };
 
     cParser operationparser( operationdata, cParser::buffer_TEXT );
     // HACK: operation potentially contains 1-2 parameters so we try to grab the whole set
@@ -147,19 +225,15 @@ basic_controller::deserialize_operation( cParser &Input ) -> bool {
 
     if( operation.code == opcode_e::op_nop ) { return true; }
 
-    if( false == operationelement.empty() ) {
-        operation.element =
-            find_or_insert(
-                operationelement,
-                guess_element_type_from_name( operationelement ) );
-    }
+    operation.mnemonic = operationname;
+    operation.element = operationelement;
 
     if( false == operationparameter.empty() ) {
         auto const parameter{ split_string_and_number( operationparameter ) };
         operation.parameter1 = static_cast<short>( parameter.second );
     }
 
-    m_program.emplace_back( operation );
+    Output.emplace_back( operation );
 
     return true;
 }
@@ -183,10 +257,11 @@ basic_controller::insert( std::string const Name, basic_element Element ) -> ele
 // runs one cycle of current program
 auto
 basic_controller::run() -> int {
-    
+
+    if( true == m_program.empty() ) { return 0; }
+
     m_accumulator.clear();
     m_popstack = false;
-    auto programline { 1 };
 
     for( auto const &operation : m_program ) {
         // TBD: replace switch with function table for better readability/maintenance?
@@ -216,7 +291,7 @@ basic_controller::run() -> int {
 
             case opcode_e::op_and: {
                 if( m_accumulator.empty() ) {
-                    log_error( "attempted AND with empty accumulator", programline );
+                    log_error( "attempted AND with empty accumulator", operation.line );
                     break;
                 }
                 m_accumulator.back() &= output( operation.element );
@@ -225,7 +300,7 @@ basic_controller::run() -> int {
 
             case opcode_e::op_ani: {
                 if( m_accumulator.empty() ) {
-                    log_error( "attempted ANI with empty accumulator", programline );
+                    log_error( "attempted ANI with empty accumulator", operation.line );
                     break;
                 }
                 m_accumulator.back() &= inverse( output( operation.element ) );
@@ -234,7 +309,7 @@ basic_controller::run() -> int {
 
             case opcode_e::op_anb: {
                 if( m_accumulator.size() < 2 ) {
-                    log_error( "attempted ANB with empty stack", programline );
+                    log_error( "attempted ANB with empty stack", operation.line );
                     break;
                 }
                 auto const operand { m_accumulator.back() };
@@ -245,7 +320,7 @@ basic_controller::run() -> int {
 
             case opcode_e::op_or: {
                 if( m_accumulator.empty() ) {
-                    log_error( "attempted OR with empty accumulator", programline );
+                    log_error( "attempted OR with empty accumulator", operation.line );
                     break;
                 }
                 m_accumulator.back() |= output( operation.element );
@@ -254,7 +329,7 @@ basic_controller::run() -> int {
 
             case opcode_e::op_ori : {
                 if( m_accumulator.empty() ) {
-                    log_error( "attempted ORI with empty accumulator", programline );
+                    log_error( "attempted ORI with empty accumulator", operation.line );
                     break;
                 }
                 m_accumulator.back() |= inverse( output( operation.element ) );
@@ -263,7 +338,7 @@ basic_controller::run() -> int {
 
             case opcode_e::op_orb: {
                 if( m_accumulator.size() < 2 ) {
-                    log_error( "attempted ORB with empty stack", programline );
+                    log_error( "attempted ORB with empty stack", operation.line );
                     break;
                 }
                 auto const operand{ m_accumulator.back() };
@@ -274,7 +349,7 @@ basic_controller::run() -> int {
 
             case opcode_e::op_out: {
                 if( m_accumulator.empty() ) {
-                    log_error( "attempted OUT with empty accumulator", programline );
+                    log_error( "attempted OUT with empty accumulator", operation.line );
                     break;
                 }
                 auto &target { element( operation.element ) };
@@ -309,7 +384,7 @@ basic_controller::run() -> int {
 
             case opcode_e::op_set: {
                 if( m_accumulator.empty() ) {
-                    log_error( "attempted SET with empty accumulator", programline );
+                    log_error( "attempted SET with empty accumulator", operation.line );
                     break;
                 }
                 if( m_accumulator.back() == 0 ) {
@@ -342,7 +417,7 @@ basic_controller::run() -> int {
 
             case opcode_e::op_rst: {
                 if( m_accumulator.empty() ) {
-                    log_error( "attempted RST with empty accumulator", programline );
+                    log_error( "attempted RST with empty accumulator", operation.line );
                     break;
                 }
                 if( m_accumulator.back() == 0 ) {
@@ -362,7 +437,6 @@ basic_controller::run() -> int {
                 break;
             }
         }
-        ++programline;
     }
 
     return 0;
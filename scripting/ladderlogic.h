@@ -91,14 +91,32 @@ private:
         short element;
         short parameter1;
         short parameter2;
+        int line; // line of the program file, for error reports
+    };
+    // plc program instruction as stored in the program file, before it's bound to elements of specific controller
+    struct source_operation {
+        opcode_e code;
+        std::string mnemonic;
+        std::string element;
+        short parameter1;
+        int line; // line of the program file, for error reports
     };
     // containers
     using element_sequence = std::vector<basic_element>;
     using name_sequence = std::vector<std::string>;
     using operation_sequence = std::vector<operation>;
     using handle_sequence = std::vector<element_handle>;
+    using source_sequence = std::vector<source_operation>;
+    struct cached_source {
+        std::filesystem::file_time_type timestamp; // modification time of the program file when it was parsed
+        std::shared_ptr<source_sequence const> source;
+    };
 // methods
-    auto deserialize_operation( cParser &Input ) -> bool;
+    // returns: content of specified program file. the file is parsed once and shared by all controllers running the program, until it's modified
+    auto fetch_source( std::string const &Filename ) -> std::shared_ptr<source_sequence const>;
+    auto deserialize_operation( cParser &Input, source_sequence &Output ) -> bool;
+    // binds provided program to controller elements, dropping instructions which are certain to fail. returns: true if the program isn't empty
+    auto compile( source_sequence const &Source ) -> bool;
     // adds provided item to the collection. returns: true if there's no duplicate with the same name, false otherwise
     auto insert( std::string const Name, basic_element Element ) -> element_handle;
     // runs one cycle of current program. returns: error code or 0 if there's no error
@@ -117,12 +135,14 @@ private:
         return m_elements[ Element - 1 ]; }
 // members
     static std::map<std::string, basic_controller::opcode_e> const m_operationcodemap;
+    static std::mutex m_sourcecachelock;
+    static std::unordered_map<std::string, cached_source> m_sourcecache; // parsed program files
     element_sequence m_elements; // collection of elements accessed by the plc program
     name_sequence m_elementnames;
     handle_sequence m_timerhandles; // indices of timer elements, timer update optimization helper
     std::string m_programfilename; // cached filename of currently loaded program
     operation_sequence m_program; // current program for the plc
-    std::vector<int> m_accumulator; // state accumulator for currently processed program rung
+    std::vector<int> m_accumulator; // state accumulator for currently processed program rung, reserved for the deepest stack the program can reach
     bool m_popstack { false }; // whether ld(i) operation should pop the accumulator stack or just add onto it
     double m_updateaccumulator { 0.0 }; // 
     double m_updaterate { 0.1 };
@@ -19,6 +19,7 @@ http://mozilla.org/MPL/2.0/.
 #include "rendering/particles.h"
 #include "world/Event.h"
 #include "world/MemCell.h"
+#include "utilities/profiler.h"
 #include "vehicle/Driver.h"
 #include "vehicle/DynObj.h"
 #include "model/AnimModel.h"
@@ -29,6 +30,8 @@ http://mozilla.org/MPL/2.0/.
 #include "utilities/Logs.h"
 #include "editor/editorTerrainStreamer.hpp"
 
+#include <future>
+
 namespace simulation {
 
 std::shared_ptr<deserializer_state>
@@ -123,6 +126,7 @@ state_serializer::deserialize_begin( std::string const &Scenariofile ) {
 // continues deserialization for given context, amount limited by time, returns true if needs to be called again
 bool
 state_serializer::deserialize_continue(std::shared_ptr<deserializer_state> state) {
+	PROFILE_ZONE("scenery loading");
 	cParser &Input = state->input;
 	scene::scratch_data &Scratchpad = state->scratchpad;
 
@@ -154,6 +158,18 @@ state_serializer::deserialize_continue(std::shared_ptr<deserializer_state> state
     }
 
     scene::Groups.close();
+    // templates included during the load aren't likely to be needed again
+    cParser::clearIncludeCache();
+    // the tables hold nearly all items they're going to have, their names can be moved to compact lookup indices
+    simulation::Events.freeze();
+    simulation::Memory.freeze();
+    simulation::Paths.freeze();
+    simulation::Traction.freeze();
+    simulation::Powergrid.freeze();
+    simulation::Instances.freeze();
+    simulation::Vehicles.freeze();
+    simulation::Trains.freeze();
+    simulation::Sounds.freeze();
 
 	scene::Groups.update_map();
 	Region->create_map_geometry();
@@ -377,11 +393,28 @@ state_serializer::deserialize_firstinit( cParser &Input, scene::scratch_data &Sc
 			
     }
 
-    simulation::Paths.InitTracks();
-    simulation::Traction.InitTraction();
-    simulation::Events.InitEvents();
-    simulation::Events.InitLaunchers();
-    simulation::Memory.InitCells();
+    // at this point the region holds all paths and traction pieces which are going to be linked
+    Region->create_lookup_index();
+
+    {
+        PROFILE_ZONE("scenery linking");
+        // paths and traction pieces link only with their own kind, and region lookups they use don't modify the region,
+        // so both passes can run concurrently
+        auto tractionlinking { std::async( std::launch::async, []() {
+            PROFILE_ZONE("traction linking");
+            simulation::Traction.InitTraction(); } ) };
+        simulation::Paths.InitTracks();
+        tractionlinking.get();
+        simulation::Traction.associate_paths();
+        // events modify the paths and models they target, the remaining passes only resolve names of items
+        // in tables which are complete at this point, and write to their own items
+        simulation::Events.InitEvents();
+        auto launcherlinking { std::async( std::launch::async, []() {
+            PROFILE_ZONE("launcher linking");
+            simulation::Events.InitLaunchers(); } ) };
+        simulation::Memory.InitCells();
+        launcherlinking.get();
+    }
 
 	if (!Scratchpad.time_initialized)
 		init_time();
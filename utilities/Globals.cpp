@@ -501,6 +501,12 @@ bool global_settings::ConfigParseSimulation(cParser& Parser, const std::string&
         return true;
     }
 
+    if (token == "brakepipesolver")
+    {
+        ParseOne(Parser, BrakePipeSolver);
+        return true;
+    }
+
     if (token == "movelight")
     {
         ParseOne(Parser, fMoveLight, 1, false);
@@ -1545,6 +1551,7 @@ global_settings::export_as_text( std::ostream &Output ) const {
     export_as_text( Output, "skyenabled", asSky );
     export_as_text( Output, "defaultext", szDefaultExt );
     export_as_text( Output, "newaircouplers", bnewAirCouplers );
+    export_as_text( Output, "brakepipesolver", BrakePipeSolver );
     export_as_text( Output, "anisotropicfiltering", AnisotropicFiltering );
     export_as_text( Output, "usevbo", bUseVBO );
     export_as_text( Output, "feedbackmode", iFeedbackMode );
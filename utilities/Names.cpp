@@ -0,0 +1,171 @@
+/*
+This Source Code Form is subject to the
+terms of the Mozilla Public License, v.
+2.0. If a copy of the MPL was not
+distributed with this file, You can
+obtain one at
+http://mozilla.org/MPL/2.0/.
+*/
+
+#include "stdafx.h"
+#include "utilities/Names.h"
+
+#include <bit>
+#include <mutex>
+
+namespace {
+
+// markers of unused and erased slots of the frozen table
+std::uint32_t const EmptySlot { 0xffffffff };
+std::uint32_t const ErasedSlot { 0xfffffffe };
+
+std::uint32_t name_hash( std::string_view const Name ) {
+
+    return static_cast<std::uint32_t>( std::hash<std::string_view>{}( Name ) );
+}
+
+} // namespace
+
+symbol::entry const symbol::m_emptyentry { {}, 0 };
+
+// returns: pool entry holding specified text, added to the pool if needed
+symbol::entry const *
+symbol::intern( std::string_view const Text ) {
+
+    if( Text.empty() ) { return &m_emptyentry; }
+
+    // entries are never released, and the deque doesn't move them, so both the entries and the lookup keys stay valid
+    static std::mutex lock;
+    static std::deque<entry> entries;
+    static std::unordered_map<std::string_view, entry const *> lookup;
+
+    std::lock_guard<std::mutex> guard { lock };
+    auto const existing { lookup.find( Text ) };
+    if( existing != lookup.end() ) {
+        return existing->second;
+    }
+    auto const &added { entries.emplace_back( entry { std::string( Text ), static_cast<std::uint32_t>( entries.size() + 1 ) } ) };
+    lookup.emplace( added.text, &added );
+    return &added;
+}
+
+// maps specified name to specified handle. returns: true if the name wasn't mapped yet, false if the existing mapping was replaced
+bool
+name_index::insert( std::string const &Name, std::size_t const Handle ) {
+
+    auto mapping { m_map.emplace( Name, Handle ) };
+    if( false == mapping.second ) {
+        mapping.first->second = Handle;
+        return false;
+    }
+    // mappings in the regular map take precedence over the frozen ones, so we only need to check for a duplicate
+    return ( find_frozen( Name ) == npos );
+}
+
+// returns: handle mapped to specified name, or npos
+std::size_t
+name_index::find( std::string const &Name ) const {
+
+    if( false == m_map.empty() ) {
+        auto const lookup { m_map.find( Name ) };
+        if( lookup != m_map.end() ) {
+            return lookup->second;
+        }
+    }
+    auto const slot { find_frozen( Name ) };
+    return (
+        slot != npos ?
+            m_frozen[ slot ].handle :
+            npos );
+}
+
+// removes mapping of specified name. returns: handle mapped to the name, or npos
+std::size_t
+name_index::erase( std::string const &Name ) {
+
+    auto handle { npos };
+    auto const slot { find_frozen( Name ) };
+    if( slot != npos ) {
+        handle = m_frozen[ slot ].handle;
+        // the slot stays occupied, to keep probe sequences of other names intact
+        m_frozen[ slot ].handle = ErasedSlot;
+    }
+    auto const lookup { m_map.find( Name ) };
+    if( lookup != m_map.end() ) {
+        handle = lookup->second;
+        m_map.erase( lookup );
+    }
+    return handle;
+}
+
+// moves all current mappings to the compact read-only part of the index
+void
+name_index::freeze() {
+
+    // gather current mappings, with ones from the regular map replacing these from the frozen table
+    std::vector<std::pair<std::string_view, std::uint32_t>> mappings;
+    mappings.reserve( m_frozen.size() / 2 + m_map.size() );
+    for( auto const &entry : m_frozen ) {
+        if( entry.handle >= ErasedSlot ) { continue; }
+        std::string_view const name { m_frozennames.data() + entry.nameoffset, entry.namelength };
+        if( ( false == m_map.empty() )
+         && ( m_map.find( std::string( name ) ) != m_map.end() ) ) {
+            continue;
+        }
+        mappings.emplace_back( name, static_cast<std::uint32_t>( entry.handle ) );
+    }
+    auto namesize { std::size_t { 0 } };
+    for( auto const &mapping : mappings ) {
+        namesize += mapping.first.size();
+    }
+    for( auto const &mapping : m_map ) {
+        mappings.emplace_back( mapping.first, static_cast<std::uint32_t>( mapping.second ) );
+        namesize += mapping.first.size();
+    }
+
+    std::string names;
+    names.reserve( namesize );
+    std::vector<frozen_entry> frozen(
+        mappings.empty() ? 0 : std::bit_ceil( mappings.size() * 2 ),
+        frozen_entry { 0, EmptySlot, 0, 0 } );
+    auto const mask { frozen.size() - 1 };
+    for( auto const &mapping : mappings ) {
+        auto const hash { name_hash( mapping.first ) };
+        auto slot { hash & mask };
+        while( frozen[ slot ].handle != EmptySlot ) {
+            slot = ( slot + 1 ) & mask;
+        }
+        frozen[ slot ] = {
+            hash,
+            mapping.second,
+            static_cast<std::uint32_t>( names.size() ),
+            static_cast<std::uint32_t>( mapping.first.size() ) };
+        names.append( mapping.first );
+    }
+    // the gathered mappings point to the old buffers, so these can be replaced only now
+    m_frozen.swap( frozen );
+    m_frozennames.swap( names );
+    decltype( m_map )().swap( m_map );
+}
+
+// returns: slot of the frozen table holding specified name, or npos
+std::size_t
+name_index::find_frozen( std::string_view const Name ) const {
+
+    if( m_frozen.empty() ) { return npos; }
+
+    auto const hash { name_hash( Name ) };
+    auto const mask { m_frozen.size() - 1 };
+    for( auto slot { hash & mask }; m_frozen[ slot ].handle != EmptySlot; slot = ( slot + 1 ) & mask ) {
+        auto const &entry { m_frozen[ slot ] };
+        if( ( entry.hash == hash )
+         && ( entry.namelength == Name.size() )
+         && ( entry.handle != ErasedSlot )
+         && ( Name.compare( 0, Name.size(), m_frozennames.data() + entry.nameoffset, entry.namelength ) == 0 ) ) {
+            return slot;
+        }
+    }
+    return npos;
+}
+
+//---------------------------------------------------------------------------
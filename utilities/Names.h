@@ -11,6 +11,95 @@ http://mozilla.org/MPL/2.0/.
 
 #include <unordered_map>
 #include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <cstdint>
+
+// text stored once in the process-wide pool. symbols made from the same text share the stored copy and its id,
+// so copies are pointer sized and comparisons don't look at the text
+class symbol {
+
+public:
+// constructors
+    symbol() = default;
+    explicit
+        symbol( std::string_view const Text ) :
+            m_entry( intern( Text ) )
+        {}
+// methods
+    std::string const &
+        str() const {
+            return m_entry->text; }
+    // returns: id of the text, unique for the lifetime of the application. empty text has id 0
+    std::uint32_t
+        id() const {
+            return m_entry->id; }
+    bool
+        empty() const {
+            return m_entry->text.empty(); }
+    bool
+        operator==( symbol const &Other ) const {
+            return m_entry == Other.m_entry; }
+    bool
+        operator!=( symbol const &Other ) const {
+            return m_entry != Other.m_entry; }
+
+private:
+// types
+    struct entry {
+        std::string text;
+        std::uint32_t id;
+    };
+// methods
+    // returns: pool entry holding specified text, added to the pool if needed
+    static
+    entry const *
+        intern( std::string_view const Text );
+// members
+    static entry const m_emptyentry;
+    entry const *m_entry { &m_emptyentry };
+};
+
+// maps item names to item handles. once the set of names is mostly complete the index can be frozen;
+// the names are then moved to a single buffer and looked up through a compact open addressing table of their hashes,
+// while names added afterwards go to a regular map
+class name_index {
+
+public:
+// types
+    static std::size_t constexpr npos { static_cast<std::size_t>( -1 ) };
+// methods
+    // maps specified name to specified handle. returns: true if the name wasn't mapped yet, false if the existing mapping was replaced
+    bool
+        insert( std::string const &Name, std::size_t const Handle );
+    // returns: handle mapped to specified name, or npos
+    std::size_t
+        find( std::string const &Name ) const;
+    // removes mapping of specified name. returns: handle mapped to the name, or npos
+    std::size_t
+        erase( std::string const &Name );
+    // moves all current mappings to the compact read-only part of the index
+    void
+        freeze();
+
+private:
+// types
+    struct frozen_entry {
+        std::uint32_t hash;
+        std::uint32_t handle;
+        std::uint32_t nameoffset; // position of the name in the name buffer
+        std::uint32_t namelength;
+    };
+// methods
+    // returns: slot of the frozen table holding specified name, or npos
+    std::size_t
+        find_frozen( std::string_view const Name ) const;
+// members
+    std::unordered_map<std::string, std::size_t> m_map; // names added after the index was frozen
+    std::vector<frozen_entry> m_frozen; // power of two sized table, filled at most half-way
+    std::string m_frozennames;
+};
 
 template <typename Type_>
 class basic_table {
@@ -30,41 +119,33 @@ public:
                 return true;
             }
             auto const itemhandle { m_items.size() - 1 };
-            // add item name to the map
-            auto mapping = m_itemmap.emplace( itemname, itemhandle );
-            if( true == mapping.second ) {
-                return true;
-            }
-            // item with this name already exists; update mapping to point to the new one, for backward compatibility
-            mapping.first->second = itemhandle;
-            return false; }
+            // add item name to the map. if item with this name already exists, the mapping is updated to point to the new one, for backward compatibility
+            return m_itemmap.insert( itemname, itemhandle ); }
 	bool insert (Type_ *Item)
 	{
 		return insert(Item, Item->name());
 	}
 	void purge (std::string const &Name)
 	{
-		auto lookup = m_itemmap.find( Name );
-		if (lookup == m_itemmap.end())
+		auto const handle = m_itemmap.find( Name );
+		if (handle == name_index::npos)
 			return;
-		delete m_items[lookup->second];
+		delete m_items[handle];
 
 		detach(Name);
 	}
 	void detach (std::string const &Name)
 	{
-		auto lookup = m_itemmap.find( Name );
-		if (lookup == m_itemmap.end())
+		auto const handle = m_itemmap.erase( Name );
+		if (handle == name_index::npos)
 			return;
 
-		m_items[lookup->second] = nullptr;
+		m_items[handle] = nullptr;
 		// TBD, TODO: remove from m_items?
-
-		m_itemmap.erase(lookup);
 	}
 	uint32_t find_id( std::string const &Name) const {
-		auto lookup = m_itemmap.find( Name );
-		return lookup != m_itemmap.end() ? lookup->second : -1;
+		auto const handle = m_itemmap.find( Name );
+		return handle != name_index::npos ? handle : -1;
 	}
 	void purge (Type_ *Item)
 	{
@@ -79,13 +160,17 @@ public:
     // locates item with specified name. returns pointer to the item, or nullptr
     Type_ *
         find( std::string const &Name ) const {
-            auto lookup = m_itemmap.find( Name );
-            return lookup != m_itemmap.end() ? m_items[lookup->second] : nullptr; }
+            auto const handle = m_itemmap.find( Name );
+            return handle != name_index::npos ? m_items[handle] : nullptr; }
+    // compacts the name index, once the table holds most of the items it's going to have
+    void
+        freeze() {
+            m_itemmap.freeze(); }
 
 protected:
 // types
     using type_sequence = std::deque<Type_ *>;
-    using index_map = std::unordered_map<std::string, std::size_t>;
+    using index_map = name_index;
 // members
     type_sequence m_items;
     index_map m_itemmap;
@@ -9,6 +9,8 @@ http://mozilla.org/MPL/2.0/.
 
 #pragma once
 
+#include "utilities/profiler.h"
+
 namespace Timer {
 
 double GetTime();
@@ -28,13 +30,32 @@ class stopwatch {
 public:
 // constructors
     stopwatch() = default;
+    explicit stopwatch( char const *Name ) :
+        m_name( Name )
+    {}
 // methods
     void
         start() {
             m_start = std::chrono::steady_clock::now(); }
 	std::chrono::duration<float, std::milli>
         stop() {
-		    m_last = std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - m_start );
+            auto const now { std::chrono::steady_clock::now() };
+		    m_last = std::chrono::duration_cast<std::chrono::microseconds>( now - m_start );
+			m_accumulator = 0.95f * m_accumulator + m_last.count() / 1000.f;
+            if( m_name != nullptr ) {
+                profiler::record( m_name, m_start, now ); }
+			return m_last; }
+    // partial measurements, for work spread over many calls within single update. commit() closes the update
+    void
+        resume() {
+            m_start = std::chrono::steady_clock::now(); }
+    void
+        pause() {
+            m_pending += std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - m_start ); }
+	std::chrono::duration<float, std::milli>
+        commit() {
+            m_last = m_pending;
+            m_pending = std::chrono::microseconds::zero();
 			m_accumulator = 0.95f * m_accumulator + m_last.count() / 1000.f;
 			return m_last; }
     float
@@ -48,22 +69,24 @@ private:
 // members
     std::chrono::time_point<std::chrono::steady_clock> m_start { std::chrono::steady_clock::now() };
     float m_accumulator { 1000.f / 30.f * 20.f }; // 20 last samples, initial 'neutral' rate of 30 fps
-    std::chrono::microseconds m_last;
+    std::chrono::microseconds m_last { 0 };
+    std::chrono::microseconds m_pending { 0 };
+    char const *m_name { nullptr }; // label of the stopwatch in profiler captures
 };
 
 struct subsystem_stopwatches {
-    stopwatch gfx_total;
-    stopwatch gfx_color;
-    stopwatch gfx_shadows;
-    stopwatch gfx_reflections;
-    stopwatch gfx_swap;
-    stopwatch gfx_gui;
-    stopwatch gfx_animate;
-    stopwatch sim_total;
-    stopwatch sim_dynamics;
-    stopwatch sim_events;
-    stopwatch sim_ai;
-    stopwatch mainloop_total;
+    stopwatch gfx_total { "gfx_total" };
+    stopwatch gfx_color { "gfx_color" };
+    stopwatch gfx_shadows { "gfx_shadows" };
+    stopwatch gfx_reflections { "gfx_reflections" };
+    stopwatch gfx_swap { "gfx_swap" };
+    stopwatch gfx_gui { "gfx_gui" };
+    stopwatch gfx_animate { "gfx_animate" };
+    stopwatch sim_total { "sim_total" };
+    stopwatch sim_dynamics { "sim_dynamics" };
+    stopwatch sim_events { "sim_events" };
+    stopwatch sim_ai { "sim_ai" };
+    stopwatch mainloop_total { "mainloop_total" };
 };
 
 extern subsystem_stopwatches subsystem;
@@ -52,6 +52,88 @@ inline bool startsWithBOM(const std::string &s)
 		&& static_cast<unsigned char>(s[1]) == 0xBB
 		&& static_cast<unsigned char>(s[2]) == 0xBF;
 }
+
+char const *const defaultBreak = "\n\r\t ;";
+
+// read-only stream buffer over shared, immutable file content
+class shared_memory_buffer : public std::streambuf
+{
+  public:
+	explicit shared_memory_buffer(std::shared_ptr<const std::string> Content) : m_content(std::move(Content))
+	{
+		auto *begin = const_cast<char *>(m_content->data());
+		setg(begin, begin, begin + m_content->size());
+	}
+
+  protected:
+	pos_type seekoff(off_type Offset, std::ios_base::seekdir Direction, std::ios_base::openmode Mode) override
+	{
+		off_type position = Offset;
+		switch (Direction)
+		{
+		case std::ios_base::cur: { position += gptr() - eback(); break; }
+		case std::ios_base::end: { position += egptr() - eback(); break; }
+		default: { break; }
+		}
+		return seekpos(position, Mode);
+	}
+	pos_type seekpos(pos_type Position, std::ios_base::openmode Mode) override
+	{
+		off_type const position = Position;
+		if ((position < 0) || (position > egptr() - eback()))
+		{
+			return pos_type(off_type(-1));
+		}
+		setg(eback(), eback() + position, egptr());
+		return Position;
+	}
+
+  private:
+	std::shared_ptr<const std::string> m_content;
+};
+
+class shared_memory_stream : public std::istream
+{
+  public:
+	explicit shared_memory_stream(std::shared_ptr<const std::string> Content) : std::istream(nullptr), m_buffer(std::move(Content))
+	{
+		rdbuf(&m_buffer);
+	}
+
+  private:
+	shared_memory_buffer m_buffer;
+};
+
+inline std::streamoff streamPosition(std::istream &Stream)
+{
+	return Stream.rdbuf()->pubseekoff(0, std::ios_base::cur);
+}
+} // namespace
+
+// token produced by default tokenization of cached file content, starting from given stream offset
+struct cached_token
+{
+	std::streamoff start; // stream offset where the scan for this token began
+	std::streamoff end; // stream offset after the scan
+	std::size_t lines; // number of line breaks consumed by the scan
+	std::string text;
+};
+
+struct cParser::include_cache_entry
+{
+	std::shared_ptr<const std::string> content;
+	std::filesystem::file_time_type timestamp;
+	std::size_t uses { 0 };
+	// token lists for default break set, built on second use of the file; [ 0 ]: case preserved, [ 1 ]: lowercase
+	std::array<std::vector<cached_token>, 2> tokens;
+	std::array<bool, 2> tokenized { false, false };
+	std::mutex lock;
+};
+
+namespace
+{
+std::mutex IncludeCacheLock;
+std::unordered_map<std::string, std::shared_ptr<cParser::include_cache_entry>> IncludeCache;
 } // namespace
 
 // constructors
@@ -69,13 +151,17 @@ cParser::cParser(std::string const &Stream, buffertype const Type, std::string P
 	case buffer_FILE:
 	{
 		Path.append(Stream);
-		mStream = std::make_shared<std::ifstream>(Path, std::ios_base::binary);
 		// content of *.inc files is potentially grouped together
 		if (Stream.size() >= 4 && ToLower(Stream.substr(Stream.size() - 4)) == ".inc")
 		{
 			mIncFile = true;
 			scene::Groups.create();
 		}
+		// *.inc files tend to be included many times over, so we keep their content in memory
+		if ((false == mIncFile) || (false == openCachedInclude(Path)))
+		{
+			mStream = std::make_shared<std::ifstream>(Path, std::ios_base::binary);
+		}
 		break;
 	}
 	case buffer_TEXT:
@@ -399,12 +485,14 @@ void cParser::readToken(std::string &out, bool ToLower, const char *Break)
 		if (out.empty())
 		{
 			mIncludeParser = nullptr;
-			out = readTokenFromStream(ToLower, Break);
+			if (false == readTokenFromCache(out, ToLower, Break))
+				out = readTokenFromStream(ToLower, Break);
 		}
 	}
 	else
 	{
-		out = readTokenFromStream(ToLower, Break);
+		if (false == readTokenFromCache(out, ToLower, Break))
+			out = readTokenFromStream(ToLower, Break);
 	}
 
 	stripFirstTokenBOM(out, ToLower, Break);
@@ -414,6 +502,110 @@ void cParser::readToken(std::string &out, bool ToLower, const char *Break)
 	handleIncludeIfPresent(out, ToLower, Break);
 }
 
+// attaches in-memory copy of specified *.inc file, loading it if needed. returns: true on success
+bool cParser::openCachedInclude(std::string const &Filename)
+{
+	std::error_code error;
+	auto const timestamp = std::filesystem::last_write_time(Filename, error);
+	if (error)
+	{
+		return false;
+	}
+
+	std::shared_ptr<include_cache_entry> entry;
+	{
+		std::lock_guard<std::mutex> lock(IncludeCacheLock);
+		auto &cached = IncludeCache[Filename];
+		if ((cached == nullptr) || (cached->timestamp != timestamp))
+		{
+			std::ifstream file(Filename, std::ios_base::binary);
+			if (false == file.is_open())
+			{
+				IncludeCache.erase(Filename);
+				return false;
+			}
+			auto content = std::make_shared<std::string>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+			cached = std::make_shared<include_cache_entry>();
+			cached->content = std::move(content);
+			cached->timestamp = timestamp;
+		}
+		++cached->uses;
+		entry = cached;
+	}
+
+	mStream = std::make_shared<shared_memory_stream>(entry->content);
+	mCacheEntry = std::move(entry);
+	return true;
+}
+
+// retrieves next token from pre-tokenized content of cached *.inc file. returns: true if the token was available
+bool cParser::readTokenFromCache(std::string &out, bool ToLower, char const *Break)
+{
+	if ((mCacheEntry == nullptr) || (false == skipComments) || (std::strcmp(Break, defaultBreak) != 0))
+	{
+		return false;
+	}
+
+	auto &entry{*mCacheEntry};
+	auto const variant{ToLower ? 1 : 0};
+	{
+		std::lock_guard<std::mutex> lock(entry.lock);
+		if (false == entry.tokenized[variant])
+		{
+			if (entry.uses < 2)
+			{
+				// files used only once aren't worth the tokenization cost
+				return false;
+			}
+			// tokenize the whole file with a scratch parser, recording where each scan started and ended
+			cParser scanner("", buffer_TEXT);
+			scanner.mStream = std::make_shared<shared_memory_stream>(entry.content);
+			auto &tokens{entry.tokens[variant]};
+			auto start{streamPosition(*scanner.mStream)};
+			while (true)
+			{
+				auto const line{scanner.mLine};
+				auto text{scanner.readTokenFromStream(ToLower, defaultBreak)};
+				if (text.empty())
+				{
+					break;
+				}
+				auto const end{streamPosition(*scanner.mStream)};
+				tokens.push_back({start, end, scanner.mLine - line, std::move(text)});
+				start = end;
+			}
+			entry.tokenized[variant] = true;
+		}
+	}
+
+	auto const &tokens{entry.tokens[variant]};
+	auto const position{streamPosition(*mStream)};
+	if ((mCacheIndex >= tokens.size()) || (tokens[mCacheIndex].start != position))
+	{
+		// not where we expected, e.g. after reading with non-default break set; locate the scan by its start offset
+		auto const lookup = std::lower_bound(std::begin(tokens), std::end(tokens), position, [](cached_token const &Token, std::streamoff const Position) { return Token.start < Position; });
+		if ((lookup == std::end(tokens)) || (lookup->start != position))
+		{
+			// either past the last token, or at a position which the default tokenization doesn't visit
+			return false;
+		}
+		mCacheIndex = std::distance(std::begin(tokens), lookup);
+	}
+
+	auto const &token{tokens[mCacheIndex]};
+	out = token.text;
+	mLine += token.lines;
+	mStream->rdbuf()->pubseekpos(token.end);
+	++mCacheIndex;
+	return true;
+}
+
+void cParser::clearIncludeCache()
+{
+	std::lock_guard<std::mutex> lock(IncludeCacheLock);
+	IncludeCache.clear();
+}
+
 std::vector<std::string> cParser::readParameters(cParser &Input)
 {
 
@@ -88,6 +88,8 @@ class cParser //: public std::stringstream
     static std::size_t countTokens( std::string const &Stream, std::string Path = "" );
     // add custom definition of text which should be ignored when retrieving tokens
     void addCommentStyle( std::string const &Commentstart, std::string const &Commentend );
+    // releases in-memory copies of included *.inc files
+    static void clearIncludeCache();
     // returns name of currently open file, or empty string for text type stream
     std::string Name() const;
     // returns number of currently processed line
@@ -98,11 +100,16 @@ class cParser //: public std::stringstream
 	bool allowRandomIncludes = false;
     bool skipComments = true;
 
+    // in-memory copy of an *.inc file, shared by all parsers including it
+    struct include_cache_entry;
+
   private:
 	void startIncludeFromParser(cParser &srcParser, bool ToLower, std::string includefile);
 	bool handleIncludeIfPresent(std::string &token, bool ToLower, const char *Break);
 	// methods:
     void readToken(std::string& out, bool ToLower = true, const char *Break = "\n\r\t ;");
+    bool readTokenFromCache( std::string &out, bool ToLower, char const *Break );
+    bool openCachedInclude( std::string const &Filename );
 	static std::vector<std::string> readParameters( cParser &Input );
     std::string readQuotes( char const Quote = '\"' );
     void skipComment( std::string const &Endmark );
@@ -124,6 +131,8 @@ class cParser //: public std::stringstream
         commentmap::value_type( "/*", "*/" ),
         commentmap::value_type( "//", "\n" ) };
     std::shared_ptr<cParser> mIncludeParser; // child class to handle include directives.
+    std::shared_ptr<include_cache_entry> mCacheEntry; // shared content of the open *.inc file, if cached
+    std::size_t mCacheIndex { 0 }; // expected position of the next token in the cached token list
     std::vector<std::string> parameters; // parameter list for included file.
     std::deque<std::string> tokens;
 };
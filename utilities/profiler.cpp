@@ -0,0 +1,317 @@
+/*
+This Source Code Form is subject to the
+terms of the Mozilla Public License, v.
+2.0. If a copy of the MPL was not
+distributed with this file, You can
+obtain one at
+http://mozilla.org/MPL/2.0/.
+*/
+
+#include "stdafx.h"
+#include "utilities/profiler.h"
+
+#include "utilities/Logs.h"
+
+namespace profiler {
+
+std::atomic<bool> enabled{false};
+
+namespace {
+
+auto const Epoch{clock::now()};
+// samples kept per thread during single capture. excess samples are dropped
+std::size_t const BufferCapacity{1 << 16};
+
+// sample storage of single thread. samples are written only by the owner, count is published with release semantics
+struct thread_buffer {
+	std::uint32_t index{0};
+	std::vector<sample> samples;
+	std::atomic<std::size_t> count{0};
+	std::atomic<std::uint32_t> generation{0}; // capture the samples belong to
+};
+
+// buffers of exited threads are kept on the free list and handed to new threads, so the registry only grows up to the peak number
+// of threads recording at the same time. samples of a reused buffer are kept, and the new owner appends to them
+std::mutex RegistryLock;
+std::vector<std::unique_ptr<thread_buffer>> Registry;
+std::vector<thread_buffer *> FreeBuffers;
+
+void release_buffer(thread_buffer *Buffer);
+
+// returns the buffer of its thread to the free list when the thread exits
+struct buffer_owner {
+	thread_buffer *buffer{nullptr};
+
+	~buffer_owner() {
+		if (buffer != nullptr) {
+			release_buffer(buffer);
+		}
+	}
+};
+thread_local buffer_owner LocalBuffer;
+
+std::atomic<bool> Capturing{false};
+std::atomic<bool> Live{false};
+std::atomic<std::uint32_t> Generation{0};
+std::atomic<thread_buffer *> MainBuffer{nullptr};
+
+// live frame view, accessed only by the main thread
+std::vector<sample> LastFrame;
+std::int64_t LastFrameStart{0};
+std::int64_t LastFrameDuration{0};
+std::size_t FrameFirstSample{0};
+clock::time_point FrameStart{Epoch};
+
+std::int64_t microseconds(clock::duration const Duration) {
+
+	return std::chrono::duration_cast<std::chrono::microseconds>(Duration).count();
+}
+
+void update_enabled() {
+
+	enabled.store(Capturing.load() || Live.load());
+}
+
+thread_buffer &local_buffer() {
+
+	if (LocalBuffer.buffer == nullptr) {
+		std::lock_guard<std::mutex> lock{RegistryLock};
+		if (false == FreeBuffers.empty()) {
+			LocalBuffer.buffer = FreeBuffers.back();
+			FreeBuffers.pop_back();
+		}
+		else {
+			auto buffer{std::make_unique<thread_buffer>()};
+			buffer->samples.resize(BufferCapacity);
+			buffer->index = static_cast<std::uint32_t>(Registry.size());
+			LocalBuffer.buffer = buffer.get();
+			Registry.emplace_back(std::move(buffer));
+		}
+	}
+	return *LocalBuffer.buffer;
+}
+
+void release_buffer(thread_buffer *Buffer) {
+
+	auto *mainbuffer{Buffer};
+	MainBuffer.compare_exchange_strong(mainbuffer, nullptr);
+	std::lock_guard<std::mutex> lock{RegistryLock};
+	FreeBuffers.emplace_back(Buffer);
+}
+
+// returns: buffer of the calling thread, or nullptr if the thread has none and its samples wouldn't be accepted anyway.
+// outside of capture only the main thread, which receives its buffer in frame(), has its samples collected
+thread_buffer *recording_buffer() {
+
+	if ((LocalBuffer.buffer == nullptr) && (false == Capturing.load(std::memory_order_relaxed))) {
+		return nullptr;
+	}
+	return &local_buffer();
+}
+
+// returns: true if the buffer should receive samples in current profiler state
+bool accepts(thread_buffer &Buffer) {
+
+	if (Capturing.load(std::memory_order_relaxed)) {
+		auto const generation{Generation.load(std::memory_order_acquire)};
+		if (Buffer.generation.load(std::memory_order_relaxed) != generation) {
+			// first sample of a new capture, discard leftovers of the previous one
+			Buffer.count.store(0, std::memory_order_relaxed);
+			Buffer.generation.store(generation, std::memory_order_release);
+		}
+		return true;
+	}
+	return (Live.load(std::memory_order_relaxed) && &Buffer == MainBuffer.load(std::memory_order_relaxed));
+}
+
+void push(char const *Name, clock::time_point const Start, clock::time_point const End) {
+
+	auto *recording{recording_buffer()};
+	if (recording == nullptr) {
+		return;
+	}
+	auto &buffer{*recording};
+	if (false == accepts(buffer)) {
+		return;
+	}
+	auto const index{buffer.count.load(std::memory_order_relaxed)};
+	if (index >= buffer.samples.size()) {
+		return;
+	}
+	buffer.samples[index] = {Name, microseconds(Start - Epoch), microseconds(End - Start), buffer.index};
+	buffer.count.store(index + 1, std::memory_order_release);
+}
+
+void write_escaped(std::ostream &Output, char const *Text) {
+
+	for (auto const *character{Text}; *character != '\0'; ++character) {
+		switch (*character) {
+			case '"':
+			case '\\': {
+				Output << '\\' << *character;
+				break;
+			}
+			default: {
+				if (static_cast<unsigned char>(*character) >= 0x20) {
+					Output << *character;
+				}
+				break;
+			}
+		}
+	}
+}
+
+} // namespace
+
+void begin_capture() {
+
+	if (true == Capturing.load()) {
+		return;
+	}
+	Generation.fetch_add(1, std::memory_order_release);
+	Capturing.store(true);
+	update_enabled();
+}
+
+bool end_capture(std::string const &Filename) {
+
+	if (false == Capturing.exchange(false)) {
+		return false;
+	}
+	update_enabled();
+	// collect samples of the finished capture. threads still inside of a zone can keep appending past the read count,
+	// which is harmless as only the published part of each buffer is read
+	auto const generation{Generation.load(std::memory_order_acquire)};
+	auto const *mainbuffer{MainBuffer.load()};
+	std::vector<std::uint32_t> threads;
+	std::vector<sample> samples;
+	{
+		std::lock_guard<std::mutex> lock{RegistryLock};
+		for (auto const &buffer : Registry) {
+			if (buffer->generation.load(std::memory_order_acquire) != generation) {
+				continue;
+			}
+			auto const count{buffer->count.load(std::memory_order_acquire)};
+			threads.emplace_back(buffer->index);
+			samples.insert(std::end(samples), std::begin(buffer->samples), std::begin(buffer->samples) + count);
+		}
+	}
+
+	std::ofstream output{Filename, std::ios::trunc};
+	if (false == output.is_open()) {
+		ErrorLog("Bad file: failed to open profiler capture file \"" + Filename + "\"", logtype::file);
+		return false;
+	}
+	output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	auto first{true};
+	for (auto const thread : threads) {
+		output << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << thread << ",\"args\":{\"name\":\""
+		       << ((mainbuffer != nullptr && mainbuffer->index == thread) ? "main" : "thread " + std::to_string(thread)) << "\"}}";
+		first = false;
+	}
+	for (auto const &sample : samples) {
+		output << (first ? "" : ",") << "\n{\"name\":\"";
+		write_escaped(output, sample.name);
+		output << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << sample.thread << ",\"ts\":" << sample.start << ",\"dur\":" << sample.duration << "}";
+		first = false;
+	}
+	output << "\n]}\n";
+
+	WriteLog("Profiler capture with " + std::to_string(samples.size()) + " samples saved to \"" + Filename + "\"");
+	return true;
+}
+
+bool capturing() {
+
+	return Capturing.load();
+}
+
+void live(bool const State) {
+
+	Live.store(State);
+	update_enabled();
+	if (false == State) {
+		LastFrame.clear();
+	}
+}
+
+bool live() {
+
+	return Live.load();
+}
+
+void frame() {
+
+	auto &buffer{local_buffer()};
+	MainBuffer.store(&buffer, std::memory_order_relaxed);
+	auto const now{clock::now()};
+
+	if (true == Live.load()) {
+		auto const count{buffer.count.load(std::memory_order_relaxed)};
+		auto const first{std::min(FrameFirstSample, count)};
+		LastFrame.assign(std::begin(buffer.samples) + first, std::begin(buffer.samples) + count);
+		// zones are recorded when they close, put them back in opening order with enclosing zones first
+		std::sort(std::begin(LastFrame), std::end(LastFrame), [](sample const &Left, sample const &Right) {
+			return (Left.start != Right.start ? Left.start < Right.start : Left.duration > Right.duration);
+		});
+		LastFrameStart = microseconds(FrameStart - Epoch);
+		LastFrameDuration = microseconds(now - FrameStart);
+		if (false == Capturing.load()) {
+			// without capture the samples are only needed for single frame
+			buffer.count.store(0, std::memory_order_relaxed);
+			FrameFirstSample = 0;
+		}
+		else {
+			FrameFirstSample = count;
+		}
+	}
+	FrameStart = now;
+}
+
+std::vector<sample> const &last_frame() {
+
+	return LastFrame;
+}
+
+std::int64_t last_frame_start() {
+
+	return LastFrameStart;
+}
+
+std::int64_t last_frame_duration() {
+
+	return LastFrameDuration;
+}
+
+void record(char const *Name, clock::time_point const Start, clock::time_point const End) {
+
+	if (enabled.load(std::memory_order_relaxed)) {
+		push(Name, Start, End);
+	}
+}
+
+void zone::open(char const *Name) noexcept {
+
+	// sample storage is acquired here, so close() doesn't need to allocate. if it can't be allocated, or the samples of the thread
+	// wouldn't be collected, the zone stays inactive
+	try {
+		if (recording_buffer() == nullptr) {
+			return;
+		}
+	}
+	catch (...) {
+		return;
+	}
+	m_name = Name;
+	m_start = clock::now();
+	m_active = true;
+}
+
+void zone::close() noexcept {
+
+	push(m_name, m_start, clock::now());
+}
+
+} // namespace profiler
+
+//---------------------------------------------------------------------------
@@ -0,0 +1,87 @@
+/*
+This Source Code Form is subject to the
+terms of the Mozilla Public License, v.
+2.0. If a copy of the MPL was not
+distributed with this file, You can
+obtain one at
+http://mozilla.org/MPL/2.0/.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// hierarchical scoped-zone profiler.
+// zones are recorded into per-thread buffers, which are written only by their owning thread and read by the exporter,
+// so recording doesn't take any locks. when neither capture nor live view is active a zone costs a single relaxed load
+namespace profiler {
+
+using clock = std::chrono::steady_clock;
+
+// single timed section of code
+struct sample {
+	char const *name; // zone names are expected to be string literals
+	std::int64_t start; // microseconds since profiler epoch
+	std::int64_t duration; // microseconds
+	std::uint32_t thread; // profiler-assigned thread index
+};
+
+// true while samples are being collected, either by capture or by live view
+extern std::atomic<bool> enabled;
+
+// starts collecting samples from all threads
+void begin_capture();
+// stops the capture and saves collected samples as chrome trace (perfetto compatible) json file. returns: true on success
+bool end_capture(std::string const &Filename);
+bool capturing();
+// enables collection of main thread samples for the live frame view
+void live(bool const State);
+bool live();
+// marks end of the main loop frame. the thread calling this function is treated as the main thread
+void frame();
+// main thread samples of the last complete frame, sorted by start time
+std::vector<sample> const &last_frame();
+// start and duration of the last complete frame, in microseconds since profiler epoch
+std::int64_t last_frame_start();
+std::int64_t last_frame_duration();
+
+// records a section measured by external means, e.g. a stopwatch
+void record(char const *Name, clock::time_point const Start, clock::time_point const End);
+
+// raii zone, records time spent in the enclosing scope
+class zone {
+
+public:
+// constructors
+	explicit zone(char const *Name) noexcept {
+		if (enabled.load(std::memory_order_relaxed)) {
+			open(Name); } }
+	zone(zone const &) = delete;
+	zone &operator=(zone const &) = delete;
+// destructor
+	~zone() {
+		if (m_active) {
+			close(); } }
+
+private:
+// methods
+	void open(char const *Name) noexcept;
+	void close() noexcept;
+// members
+	char const *m_name{nullptr};
+	clock::time_point m_start;
+	bool m_active{false};
+};
+
+} // namespace profiler
+
+#define PROFILER_CONCATENATE_IMPL(a, b) a##b
+#define PROFILER_CONCATENATE(a, b) PROFILER_CONCATENATE_IMPL(a, b)
+// declares a zone covering the rest of the current scope
+#define PROFILE_ZONE(Name) profiler::zone const PROFILER_CONCATENATE(profilerzone_, __LINE__){Name}
+
+//---------------------------------------------------------------------------
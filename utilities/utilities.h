@@ -12,6 +12,11 @@ http://mozilla.org/MPL/2.0/.
 #include "stdafx.h"
 #include "utilities/parser.h"
 
+#include <bit>
+#include <condition_variable>
+#include <deque>
+#include <future>
+
 /*rozne takie duperele do operacji na stringach w paszczalu, pewnie w delfi sa lepsze*/
 /*konwersja zmiennych na stringi, funkcje matematyczne, logiczne, lancuchowe, I/O etc*/
 
@@ -430,6 +435,200 @@ class condition_variable
 	bool m_spurious{true};
 };
 
+// fixed capacity ring buffer, safe to use without locking by single producer and single consumer thread
+template <typename Type_> class spsc_queue
+{
+
+  public:
+	// constructors
+	explicit spsc_queue(std::size_t const Capacity) : m_items(std::bit_ceil(Capacity)), m_mask(m_items.size() - 1) {}
+	// methods
+	// adds provided item to the queue. returns: false if the queue is full
+	bool push(Type_ const &Item)
+	{
+		auto const head{m_head.load(std::memory_order_relaxed)};
+		if (head - m_tail.load(std::memory_order_acquire) == m_items.size())
+		{
+			return false;
+		}
+		m_items[head & m_mask] = Item;
+		m_head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+	// retrieves oldest item from the queue. returns: false if the queue is empty
+	bool pop(Type_ &Item)
+	{
+		auto const tail{m_tail.load(std::memory_order_relaxed)};
+		if (tail == m_head.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+		Item = m_items[tail & m_mask];
+		m_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+	bool empty() const
+	{
+		return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+	}
+
+  private:
+	// members
+	std::vector<Type_> m_items;
+	std::size_t const m_mask;
+	// producer and consumer indices are kept on separate cache lines
+	alignas(64) std::atomic<std::size_t> m_head{0};
+	alignas(64) std::atomic<std::size_t> m_tail{0};
+};
+
+// fixed capacity ring buffer, safe to use without locking by multiple producer threads and single consumer thread.
+// each slot carries a sequence number telling whether it's free for the producers or published for the consumer
+template <typename Type_> class mpsc_queue
+{
+
+  public:
+	// constructors
+	explicit mpsc_queue(std::size_t const Capacity) : m_size(std::bit_ceil(Capacity)), m_mask(m_size - 1), m_slots(std::make_unique<slot[]>(m_size))
+	{
+		for (std::size_t idx = 0; idx < m_size; ++idx)
+		{
+			m_slots[idx].sequence.store(idx, std::memory_order_relaxed);
+		}
+	}
+	// methods
+	// adds provided item to the queue. returns: false if the queue is full
+	bool push(Type_ const &Item)
+	{
+		auto head{m_head.load(std::memory_order_relaxed)};
+		while (true)
+		{
+			auto &slot{m_slots[head & m_mask]};
+			auto const sequence{slot.sequence.load(std::memory_order_acquire)};
+			auto const difference{static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(head)};
+			if (difference == 0)
+			{
+				// slot is free, try to claim it
+				if (m_head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed))
+				{
+					slot.item = Item;
+					slot.sequence.store(head + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (difference < 0)
+			{
+				// slot still holds an item the consumer didn't retrieve yet
+				return false;
+			}
+			else
+			{
+				// another producer claimed the slot first
+				head = m_head.load(std::memory_order_relaxed);
+			}
+		}
+	}
+	// retrieves oldest item from the queue. returns: false if the queue is empty, or the oldest item isn't published yet
+	bool pop(Type_ &Item)
+	{
+		auto const tail{m_tail.load(std::memory_order_relaxed)};
+		auto &slot{m_slots[tail & m_mask]};
+		if (slot.sequence.load(std::memory_order_acquire) != tail + 1)
+		{
+			return false;
+		}
+		Item = slot.item;
+		slot.sequence.store(tail + m_size, std::memory_order_release);
+		m_tail.store(tail + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+  private:
+	// types
+	struct slot
+	{
+		std::atomic<std::size_t> sequence;
+		Type_ item;
+	};
+	// members
+	std::size_t const m_size;
+	std::size_t const m_mask;
+	std::unique_ptr<slot[]> m_slots;
+	// producer and consumer indices are kept on separate cache lines
+	alignas(64) std::atomic<std::size_t> m_head{0};
+	alignas(64) std::atomic<std::size_t> m_tail{0};
+};
+
+// fixed set of persistent worker threads, executing queued jobs in the order of submission
+class worker_pool
+{
+
+  public:
+	// constructors
+	explicit worker_pool(std::size_t const Threadcount)
+	{
+		for (std::size_t idx = 0; idx < Threadcount; ++idx)
+		{
+			m_threads.emplace_back(&worker_pool::run, this);
+		}
+	}
+	worker_pool(worker_pool const &) = delete;
+	worker_pool &operator=(worker_pool const &) = delete;
+	// destructor
+	// NOTE: jobs still in the queue are executed before the workers exit
+	~worker_pool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_exit = true;
+		}
+		m_condition.notify_all();
+		for (auto &thread : m_threads)
+		{
+			thread.join();
+		}
+	}
+	// methods
+	// queues provided job. returns: future which becomes ready once the job is executed
+	template <class Job_> std::future<void> submit(Job_ Job)
+	{
+		std::packaged_task<void()> task(std::move(Job));
+		auto result{task.get_future()};
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_jobs.emplace_back(std::move(task));
+		}
+		m_condition.notify_one();
+		return result;
+	}
+
+  private:
+	// methods
+	void run()
+	{
+		while (true)
+		{
+			std::packaged_task<void()> task;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condition.wait(lock, [this]() { return m_exit || false == m_jobs.empty(); });
+				if (m_jobs.empty())
+				{
+					return;
+				}
+				task = std::move(m_jobs.front());
+				m_jobs.pop_front();
+			}
+			task();
+		}
+	}
+	// members
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::deque<std::packaged_task<void()>> m_jobs;
+	bool m_exit{false};
+	std::vector<std::thread> m_threads;
+};
+
 } // namespace threading
 
 //---------------------------------------------------------------------------
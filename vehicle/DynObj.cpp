@@ -210,7 +210,7 @@ int TAnim::TypeSet(int i, TMoverParameters currentMover, int fl)
     default:
         iFlags = 0;
     }
-    yUpdate = nullptr;
+    yUpdate = animation_update::none;
     return iFlags & 15; // ile wskaźników rezerwować dla danego typu animacji
 };
 
@@ -730,6 +730,25 @@ void TDynamicObject::UpdateWiper(TAnim* pAnim)
 		pAnim->smElement[2]->SetRotate(float3(0, 1, 0), smoothInterpolate(0.0, -rotateAngle, dWiperPos[i]));
 }
 
+// wywołanie aktualizacji właściwej dla danej animacji
+void TDynamicObject::UpdateAnimation(TAnim &Animation)
+{
+    switch (Animation.yUpdate)
+    {
+    case animation_update::axle: { UpdateAxle(&Animation); break; }
+    case animation_update::door_translate: { UpdateDoorTranslate(&Animation); break; }
+    case animation_update::door_rotate: { UpdateDoorRotate(&Animation); break; }
+    case animation_update::door_fold: { UpdateDoorFold(&Animation); break; }
+    case animation_update::door_plug: { UpdateDoorPlug(&Animation); break; }
+    case animation_update::pantograph: { UpdatePant(&Animation); break; }
+    case animation_update::platform_translate: { UpdatePlatformTranslate(&Animation); break; }
+    case animation_update::platform_rotate: { UpdatePlatformRotate(&Animation); break; }
+    case animation_update::mirror: { UpdateMirror(&Animation); break; }
+    case animation_update::wiper: { UpdateWiper(&Animation); break; }
+    default: { break; } // animacja pusta
+    }
+}
+
 /*
 void TDynamicObject::UpdateLeverDouble(TAnim *pAnim)
 { // animacja gałki zależna od double
@@ -816,13 +835,19 @@ void TDynamicObject::ABuLittleUpdate(double ObjSqrDist)
 
     if (ObjSqrDist < 400 * 400 ) // gdy bliżej niż 400m
     {
-        for( auto &animation : pAnimations ) {
-            // wykonanie kolejnych animacji
-            if( ObjSqrDist < animation.fMaxDist
-             && animation.yUpdate ) {
-                // jeśli zdefiniowana funkcja aktualizacja animacji (położenia submodeli
-                animation.yUpdate( &animation );
+        // animations are grouped by type, groups with all elements out of range are skipped as a whole
+        auto animation { std::begin( pAnimations ) };
+        for( auto type = 0; type < ANIM_TYPES; ++type ) {
+            auto const groupend { animation + iAnimType[ type ] };
+            if( ObjSqrDist < fAnimMaxDist[ type ] ) {
+                for( ; animation != groupend; ++animation ) {
+                    // wykonanie kolejnych animacji
+                    if( ObjSqrDist < animation->fMaxDist ) {
+                        UpdateAnimation( *animation );
+                    }
+                }
             }
+            animation = groupend;
         }
 
         if( mdModel != nullptr
@@ -1963,7 +1988,7 @@ TDynamicObject::Init(std::string Name, // nazwa pojazdu, np. "EU07-424"
     // utworzenie parametrów fizyki
     MoverParameters = new TMoverParameters(iDirection ? fVel : -fVel, Type_Name, asName, Cab);
     // McZapkie: TypeName musi byc nazwą CHK/MMD pojazdu
-    if (!MoverParameters->LoadFIZ(asBaseDir))
+    if (!MoverParameters->LoadFIZ(asBaseDir, true))
     { // jak wczytanie CHK się nie uda, to błąd
         if (ConversionError == 666)
             ErrorLog( "Bad vehicle: failed to locate definition file \"" + BaseDir + "/" + Type_Name + ".fiz" + "\"" );
@@ -3529,7 +3554,12 @@ bool TDynamicObject::Update(double dt, double dt1)
 			MED_oldFED = FzadED;
         }
 
-        Mechanik->Update(dt1); // przebłyski świadomości AI
+        Timer::subsystem.sim_ai.resume();
+        {
+            PROFILE_ZONE( "ai" );
+            Mechanik->Update(dt1); // przebłyski świadomości AI
+        }
+        Timer::subsystem.sim_ai.pause();
     }
 
     // fragment "z EXE Kursa"
@@ -5352,7 +5382,7 @@ void TDynamicObject::LoadMMediaFile( std::string const &TypeName, std::string co
                         if (pAnimations[i].smAnimated)
                         { //++iAnimatedAxles;
                             pAnimations[i].smAnimated->WillBeAnimated(); // wyłączenie optymalizacji transformu
-							pAnimations[i].yUpdate = std::bind( &TDynamicObject::UpdateAxle, this, std::placeholders::_1 );
+							pAnimations[i].yUpdate = animation_update::axle;
 							pAnimations[i].fMaxDist = Global.fDistanceFactor * MoverParameters->WheelDiameter * 200;
 							pAnimations[i].fMaxDist *= pAnimations[i].fMaxDist;
                         }
@@ -5563,7 +5593,7 @@ void TDynamicObject::LoadMMediaFile( std::string const &TypeName, std::string co
                             pants[ i ].smElement[ 4 ] = GetSubmodelFromName( mdModel, asAnimName );
                             if( pants[ i ].smElement[ 4 ] ) {
                                 pants[ i ].smElement[ 4 ]->WillBeAnimated();
-                                pants[ i ].yUpdate = std::bind( &TDynamicObject::UpdatePant, this, std::placeholders::_1 );
+                                pants[ i ].yUpdate = animation_update::pantograph;
                                 pants[ i ].fMaxDist = 300 * 300; // nie podnosić w większej odległości
                                 pants[ i ].iNumber = i;
                             }
@@ -5735,16 +5765,16 @@ void TDynamicObject::LoadMMediaFile( std::string const &TypeName, std::string co
                             switch( MoverParameters->Doors.type )
                             { // od razu zapinamy potrzebny typ animacji
                             case 1:
-								pAnimations[ i + j ].yUpdate = std::bind( &TDynamicObject::UpdateDoorTranslate, this, std::placeholders::_1 );
+								pAnimations[ i + j ].yUpdate = animation_update::door_translate;
                                 break;
                             case 2:
-								pAnimations[ i + j ].yUpdate = std::bind( &TDynamicObject::UpdateDoorRotate, this, std::placeholders::_1 );
+								pAnimations[ i + j ].yUpdate = animation_update::door_rotate;
                                 break;
                             case 3:
-								pAnimations[ i + j ].yUpdate = std::bind( &TDynamicObject::UpdateDoorFold, this, std::placeholders::_1 );
+								pAnimations[ i + j ].yUpdate = animation_update::door_fold;
                                 break; // obrót 3 kolejnych submodeli
 							case 4:
-								pAnimations[ i + j ].yUpdate = std::bind( &TDynamicObject::UpdateDoorPlug, this, std::placeholders::_1 );
+								pAnimations[ i + j ].yUpdate = animation_update::door_plug;
 								break;
 							default:
 								break;
@@ -5777,10 +5807,10 @@ void TDynamicObject::LoadMMediaFile( std::string const &TypeName, std::string co
                             switch( MoverParameters->Doors.step_type )
                             { // od razu zapinamy potrzebny typ animacji
                             case 1: // shift
-								pAnimations[ i + j ].yUpdate = std::bind( &TDynamicObject::UpdatePlatformTranslate, this, std::placeholders::_1 );
+								pAnimations[ i + j ].yUpdate = animation_update::platform_translate;
                                 break;
                             case 2: // rotate
-								pAnimations[ i + j ].yUpdate = std::bind( &TDynamicObject::UpdatePlatformRotate, this, std::placeholders::_1 );
+								pAnimations[ i + j ].yUpdate = animation_update::platform_rotate;
                                 break;
 							default:
 								break;
@@ -5811,7 +5841,7 @@ void TDynamicObject::LoadMMediaFile( std::string const &TypeName, std::string co
                             pAnimations[ i + j ].smAnimated->WillBeAnimated(); // wyłączenie optymalizacji transformu
                             // od razu zapinamy potrzebny typ animacji
                             auto const offset { pAnimations[ i + j ].smAnimated->offset() };
-                            pAnimations[ i + j ].yUpdate = std::bind( &TDynamicObject::UpdateMirror, this, std::placeholders::_1 );
+                            pAnimations[ i + j ].yUpdate = animation_update::mirror;
                             // we don't expect more than 2-4 mirrors, so it should be safe to store submodel location (front/rear) in the higher bits
                             // parzyste działają inaczej niż nieparzyste
                             pAnimations[ i + j ].iNumber =
@@ -5868,7 +5898,7 @@ void TDynamicObject::LoadMMediaFile( std::string const &TypeName, std::string co
 								wipers[i].smElement[2]->WillBeAnimated();
 								// auto const offset{wipers[i].smElement[0]->offset()};
 							}
-							wipers[i].yUpdate = std::bind(&TDynamicObject::UpdateWiper, this, std::placeholders::_1);
+							wipers[i].yUpdate = animation_update::wiper;
 							wipers[i].fMaxDist = 150 * 150;
 							wipers[i].iNumber = i;
 						}
@@ -7026,6 +7056,19 @@ void TDynamicObject::LoadMMediaFile( std::string const &TypeName, std::string co
     Global.asCurrentTexturePath = paths::textures; // kiedyś uproszczone wnętrze mieszało tekstury nieba
     Global.asCurrentDynamicPath = "";
 
+    // activation range of each animation group, lets the update skip whole groups for distant vehicles
+    {
+        auto animation { std::cbegin( pAnimations ) };
+        for( auto type = 0; type < ANIM_TYPES; ++type ) {
+            fAnimMaxDist[ type ] = -1.f;
+            for( auto const groupend { animation + iAnimType[ type ] }; animation != groupend; ++animation ) {
+                if( animation->yUpdate != animation_update::none ) {
+                    fAnimMaxDist[ type ] = std::max( fAnimMaxDist[ type ], animation->fMaxDist );
+                }
+            }
+        }
+    }
+
     // position sound emitters which weren't defined in the config file
     // engine sounds, centre of the vehicle
     auto const enginelocation { glm::vec3 {0.f, MoverParameters->Dim.H * 0.5f, 0.f } };
@@ -8575,6 +8618,8 @@ TDynamicObject::powertrain_sounds::render( TMoverParameters const &Vehicle, doub
 // legacy method, calculates changes in simulation state over specified time
 void
 vehicle_table::update( double Deltatime, int Iterationcount ) {
+
+    PROFILE_ZONE( "vehicles" );
     // Ra: w zasadzie to trzeba by utworzyć oddzielną listę taboru do liczenia fizyki
     //    na którą by się zapisywały wszystkie pojazdy będące w ruchu
     //    pojazdy stojące nie potrzebują aktualizacji, chyba że np. ktoś im zmieni nastawę hamulca
@@ -8594,6 +8639,7 @@ vehicle_table::update( double Deltatime, int Iterationcount ) {
             for( auto *vehicle : m_items ) {
                 vehicle->UpdateForce( Deltatime );
             }
+            update_brake_pipes( Deltatime );
             for( auto *vehicle : m_items ) {
                 vehicle->FastUpdate( Deltatime );
             }
@@ -8602,6 +8648,7 @@ vehicle_table::update( double Deltatime, int Iterationcount ) {
     for( auto *vehicle : m_items ) {
         vehicle->UpdateForce( Deltatime );
     }
+    update_brake_pipes( Deltatime );
 
     auto const totaltime { Deltatime * Iterationcount }; // całkowity czas
 
@@ -8614,6 +8661,108 @@ vehicle_table::update( double Deltatime, int Iterationcount ) {
     erase_disabled();
 }
 
+void
+vehicle_table::pipe_links::clear() {
+
+    front.clear();
+    rear.clear();
+    frontpressure.clear();
+    rearpressure.clear();
+    frontsection.clear();
+    rearsection.clear();
+    frontflow.clear();
+    rearflow.clear();
+}
+
+// calculates air flow in the main brake pipe between coupled vehicles of all consists
+// NOTE: all flows are calculated from the same pressure snapshot, so the result doesn't depend on vehicle update order
+void
+vehicle_table::update_brake_pipes( double const Deltatime ) {
+
+    if( ( false == Global.BrakePipeSolver )
+     || ( Deltatime == 0.0 ) ) {
+        return;
+    }
+
+    PROFILE_ZONE( "brake pipes" );
+    // vehicles with inactive physics don't initiate the exchange, but still receive the air
+    // NOTE: same condition as in TDynamicObject::Update()
+    auto const isactive {
+        []( TDynamicObject const *Vehicle ) {
+            return ( ( Vehicle->MoverParameters->PhysicActivation )
+                  || ( Vehicle->MechInside ) ); } };
+    // gather pneumatic couplings...
+    m_pipelinks.clear();
+    for( auto *vehicle : m_items ) {
+        if( false == vehicle->bEnabled ) { continue; }
+        auto *mover { vehicle->MoverParameters };
+        for( int side = end::front; side <= end::rear; ++side ) {
+            auto const &coupler { mover->Couplers[ side ] };
+            auto *neighbour { coupler.Connected };
+            if( neighbour == nullptr ) { continue; }
+            // each coupling is processed once, by the vehicle with lower address
+            if( std::less<TMoverParameters *>()( neighbour, mover ) ) { continue; }
+
+            auto const &neighbourcoupler { neighbour->Couplers[ coupler.ConnectedNr ] };
+            auto const *neighbourvehicle { mover->Neighbours[ side ].vehicle };
+            auto const neighbouractive { (
+                ( neighbourvehicle != nullptr ) && ( neighbourvehicle->MoverParameters == neighbour ) ?
+                    isactive( neighbourvehicle ) :
+                    neighbour->PhysicActivation ) };
+            // each side takes part in the exchange if it's active and has the pipe coupled at its end
+            auto const frontsection { (
+                ( isactive( vehicle ) && TestFlag( coupler.CouplingFlag, ctrain_pneumatic ) ) ?
+                    mover->PipeCouplingSection() :
+                    0.0 ) };
+            auto const rearsection { (
+                ( neighbouractive && TestFlag( neighbourcoupler.CouplingFlag, ctrain_pneumatic ) ) ?
+                    neighbour->PipeCouplingSection() :
+                    0.0 ) };
+            if( ( frontsection == 0.0 )
+             && ( rearsection == 0.0 ) ) {
+                continue;
+            }
+            m_pipelinks.front.emplace_back( mover );
+            m_pipelinks.rear.emplace_back( neighbour );
+            m_pipelinks.frontpressure.emplace_back( mover->PipePress );
+            m_pipelinks.rearpressure.emplace_back( neighbour->PipePress );
+            m_pipelinks.frontsection.emplace_back( frontsection );
+            m_pipelinks.rearsection.emplace_back( rearsection );
+        }
+    }
+    auto const linkcount { m_pipelinks.size() };
+    if( linkcount == 0 ) { return; }
+    // ...calculate the flows in a single pass over contiguous data...
+    m_pipelinks.frontflow.resize( linkcount );
+    m_pipelinks.rearflow.resize( linkcount );
+    auto const *frontpressure { m_pipelinks.frontpressure.data() };
+    auto const *rearpressure { m_pipelinks.rearpressure.data() };
+    auto const *frontsection { m_pipelinks.frontsection.data() };
+    auto const *rearsection { m_pipelinks.rearsection.data() };
+    auto *frontflow { m_pipelinks.frontflow.data() };
+    auto *rearflow { m_pipelinks.rearflow.data() };
+    auto const halfstep { 0.5 * Deltatime };
+    for( std::size_t idx = 0; idx < linkcount; ++idx ) {
+        frontflow[ idx ] = halfstep * PF( frontpressure[ idx ], rearpressure[ idx ], frontsection[ idx ] );
+        rearflow[ idx ] = halfstep * PF( frontpressure[ idx ], rearpressure[ idx ], rearsection[ idx ] );
+    }
+    // ...and pass them to the pipes
+    for( std::size_t idx = 0; idx < linkcount; ++idx ) {
+        auto *front { m_pipelinks.front[ idx ] };
+        auto *rear { m_pipelinks.rear[ idx ] };
+        auto const flow { frontflow[ idx ] + rearflow[ idx ] };
+        front->Pipe->Flow( flow );
+        rear->Pipe->Flow( -flow );
+        // significant exchange wakes up the other vehicle
+        if( frontflow[ idx ] * frontflow[ idx ] > 0.00000000000001 ) {
+            rear->switch_physics( true );
+        }
+        if( rearflow[ idx ] * rearflow[ idx ] > 0.00000000000001 ) {
+            front->switch_physics( true );
+        }
+    }
+}
+
 // legacy method, checks for presence and height of traction wire for specified vehicle
 void
 vehicle_table::update_traction( TDynamicObject *Vehicle ) {
@@ -42,8 +42,20 @@ int const ANIM_WIPERS = 9;
 int const ANIM_TYPES = 10; // Ra: ilość typów animacji
 
 class TAnim;
-//typedef void(__closure *TUpdate)(TAnim *pAnim); // typ funkcji aktualizującej położenie submodeli
-typedef std::function<void(TAnim *)> TUpdate; // __closure is Borland-specific extension
+// rodzaj aktualizacji położenia submodeli animacji
+enum class animation_update : std::uint8_t {
+    none,
+    axle,
+    door_translate,
+    door_rotate,
+    door_fold,
+    door_plug,
+    pantograph,
+    platform_translate,
+    platform_rotate,
+    mirror,
+    wiper
+};
 
 // McZapkie-250202
 int const MaxAxles = 16; // ABu 280105: zmienione z 8 na 16
@@ -157,7 +169,7 @@ public:
     float fSpeed; // parametr szybkości animacji
     int iNumber; // numer kolejny obiektu
 
-    TUpdate yUpdate; // metoda TDynamicObject aktualizująca animację
+    animation_update yUpdate { animation_update::none }; // metoda TDynamicObject aktualizująca animację
 /*
     void Parovoz(); // wykonanie obliczeń animacji
 */
@@ -280,12 +292,14 @@ public:
     std::array<int, ANIM_TYPES> iAnimType{ 0 }; // 0-osie,1-drzwi,2-obracane,3-zderzaki,4-wózki,5-pantografy,6-tłoki
 private:
     int iAnimations; // liczba obiektów animujących
-    std::vector<TAnim> pAnimations;
+    std::vector<TAnim> pAnimations; // grouped by animation type, in order of iAnimType
+    std::array<float, ANIM_TYPES> fAnimMaxDist{}; // largest activation distance within each animation group NOTE: square of actual distance
     TSubModel ** pAnimated; // lista animowanych submodeli (może być ich więcej niż obiektów animujących)
     double dWheelAngle[3]; // kąty obrotu kół: 0=przednie toczne, 1=napędzające i wiązary, 2=tylne toczne
 /*
     void UpdateNone(TAnim *pAnim){}; // animacja pusta (funkcje ustawiania submodeli, gdy blisko kamery)
 */
+    void UpdateAnimation(TAnim &Animation); // wywołanie aktualizacji właściwej dla danej animacji
     void UpdateAxle(TAnim *pAnim); // animacja osi
     void UpdateDoorTranslate(TAnim *pAnim); // animacja drzwi - przesuw
     void UpdateDoorRotate(TAnim *pAnim); // animacja drzwi - obrót
@@ -877,9 +891,30 @@ public:
         DynamicList( bool const Onlycontrolled = false ) const;
 
 private:
+// types
+    // main brake pipe couplings of all consists, stored as parallel arrays for a single pass solver
+    struct pipe_links {
+        std::vector<TMoverParameters *> front; // vehicle on the first side of the coupling
+        std::vector<TMoverParameters *> rear; // vehicle on the second side of the coupling
+        std::vector<double> frontpressure;
+        std::vector<double> rearpressure;
+        std::vector<double> frontsection; // coupling cross-section seen from the first vehicle, 0 if it doesn't take part in the exchange
+        std::vector<double> rearsection;
+        std::vector<double> frontflow; // air flow into the first vehicle, half calculated with section of each vehicle
+        std::vector<double> rearflow;
+
+        void clear();
+        std::size_t size() const { return front.size(); }
+    };
+// methods
+    // calculates air flow in the main brake pipe between coupled vehicles of all consists
+    void
+        update_brake_pipes( double const Deltatime );
     // maintenance; removes from tracks consists with vehicles marked as disabled
     bool
         erase_disabled();
+// members
+    pipe_links m_pipelinks;
 };
 
 
@@ -43,6 +43,7 @@ void TGauge::Init(TSubModel *Submodel, TSubModel *Submodelon, TGaugeAnimation Ty
     m_interpolatescale = Interpolatescale;
     m_endvalue = Endvalue;
     m_endscale = Endscale;
+    m_animatedvalue = std::numeric_limits<float>::quiet_NaN(); // force update of the (new) submodels
 
     if( m_animation == TGaugeAnimation::gt_Digital ) {
 
@@ -388,6 +389,14 @@ void TGauge::Update( bool const Power ) {
         }
     }
     // update submodel animations
+    // most of the controls stay still for extended periods of time, so the animations are refreshed only when they change
+    auto const scaledvalue { GetScaledValue() };
+    if( ( scaledvalue == m_animatedvalue )
+     && ( false == is_animation_stale() ) ) {
+        return;
+    }
+    m_animatedvalue = scaledvalue;
+    m_animationowner = TSubModel::iInstance;
     UpdateAnimation( SubModel );
     UpdateAnimation( SubModelOn );
 };
@@ -452,6 +461,24 @@ float TGauge::GetScaledValue() const {
     return false == m_interpolatescale ? m_value * m_scale + m_offset : m_value * std::lerp(m_scale, m_endscale, std::clamp(m_value / m_endvalue, 0.f, 1.f)) + m_offset;
 }
 
+// returns: true if the submodel animations set by the gauge are no longer in effect
+bool
+TGauge::is_animation_stale() const {
+
+    if( m_animationowner != TSubModel::iInstance ) {
+        // animations are tied to the model instance which was active when they were set
+        return true;
+    }
+    // shared submodels could be animated in the meantime on behalf of another instance
+    // NOTE: digital gauges animate only child submodels, but they're always set together with the others
+    if( ( m_animation == TGaugeAnimation::gt_Digital )
+     || ( m_animation == TGaugeAnimation::gt_Unknown ) ) {
+        return false;
+    }
+    return ( ( SubModel != nullptr ) && ( SubModel->iAnimOwner != TSubModel::iInstance ) )
+        || ( ( SubModelOn != nullptr ) && ( SubModelOn->iAnimOwner != TSubModel::iInstance ) );
+}
+
 void
 TGauge::UpdateAnimation( TSubModel *Submodel ) {
 
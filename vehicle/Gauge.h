@@ -83,6 +83,8 @@ private:
         GetScaledValue() const;
     void
         UpdateAnimation( TSubModel *Submodel );
+    bool
+        is_animation_stale() const;
 
 // members
     TGaugeAnimation m_animation { TGaugeAnimation::gt_Unknown }; // typ ruchu
@@ -95,6 +97,8 @@ private:
     float m_endscale { -1.f }; // scale applied to the value at the end of accepted value range
     float m_endvalue { -1.f }; // end value of accepted value range
     bool m_interpolatescale { false };
+    float m_animatedvalue { std::numeric_limits<float>::quiet_NaN() }; // scaled value last applied to the submodels
+    std::uintptr_t m_animationowner { 0 }; // model instance active when the submodels were last animated
     char m_datatype; // typ zmiennej parametru: f-float, d-double, i-int
     union {
         // wskaźnik na parametr pokazywany przez animację
@@ -58,4 +58,60 @@ void perfgraph_panel::render_contents() {
 
 	ImGui::SliderFloat(STR_C("Range"), &max, 0.1f, 250.0f);
 	ImGui::PlotLines("##timer", &history[0], history.size(), pos, label.c_str(), 0.0f, max, ImVec2(500, 200));
+
+	render_zones();
+}
+
+void perfgraph_panel::render_zones() {
+
+	auto live{profiler::live()};
+	if (ImGui::Checkbox(STR_C("Zones"), &live))
+		profiler::live(live);
+	ImGui::SameLine();
+	if (false == profiler::capturing())
+	{
+		if (ImGui::Button(STR_C("Start capture")))
+			profiler::begin_capture();
+	}
+	else
+	{
+		if (ImGui::Button(STR_C("Save capture")))
+			profiler::end_capture(capture_filename);
+	}
+
+	if (!live)
+		return;
+
+	// flame view of the last frame; zone nesting is derived from the sample time ranges
+	auto const &samples{profiler::last_frame()};
+	auto const framestart{profiler::last_frame_start()};
+	auto const frameduration{std::max<std::int64_t>(profiler::last_frame_duration(), 1)};
+	auto const width{500.0f};
+	auto const rowheight{ImGui::GetTextLineHeightWithSpacing()};
+
+	std::vector<std::int64_t> openzones; // end times of zones enclosing the current sample
+	auto *drawlist{ImGui::GetWindowDrawList()};
+	auto const origin{ImGui::GetCursorScreenPos()};
+	auto depth{0};
+	for (auto const &sample : samples)
+	{
+		while (!openzones.empty() && openzones.back() <= sample.start)
+			openzones.pop_back();
+		depth = std::max<int>(depth, openzones.size());
+
+		auto const left{origin.x + width * (sample.start - framestart) / frameduration};
+		auto const right{std::max(left + 1.0f, origin.x + width * (sample.start + sample.duration - framestart) / frameduration)};
+		auto const top{origin.y + rowheight * openzones.size()};
+		ImVec2 const topleft{std::max(left, origin.x), top};
+		ImVec2 const bottomright{std::min(right, origin.x + width), top + rowheight - 1.0f};
+		drawlist->AddRectFilled(topleft, bottomright, ImGui::GetColorU32(openzones.size() % 2 ? ImGuiCol_PlotHistogram : ImGuiCol_PlotLines));
+		drawlist->PushClipRect(topleft, bottomright, true);
+		drawlist->AddText(ImVec2(topleft.x + 2.0f, topleft.y), ImGui::GetColorU32(ImGuiCol_Text), sample.name);
+		drawlist->PopClipRect();
+		if (ImGui::IsMouseHoveringRect(topleft, bottomright))
+			ImGui::SetTooltip("%s: %.3f ms", sample.name, sample.duration / 1000.0);
+
+		openzones.emplace_back(sample.start + sample.duration);
+	}
+	ImGui::Dummy(ImVec2(width, rowheight * (depth + 1)));
 }
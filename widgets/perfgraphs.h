@@ -40,6 +40,10 @@ class perfgraph_panel : public ui_panel
 	    "mainloop_total"
 	};
 
+	std::string const capture_filename{"profiler.json"};
+
+	void render_zones();
+
   public:
 	perfgraph_panel();
 
@@ -47,11 +47,11 @@ basic_event::event_conditions::init() {
 
     if( flags & ( flags::track_busy | flags::track_free ) ) {
         for( auto &target : *memcompare_cells ) {
-            tracks.emplace_back( simulation::Paths.find( std::get<std::string>( target ) ) );
+            tracks.emplace_back( simulation::Paths.find( std::get<symbol>( target ).str() ) );
             if( tracks.back() == nullptr ) {
                 // legacy compatibility behaviour, instead of disabling the event we disable the memory cell comparison test
 //                m_ignored = true; // deaktywacja
-//                ErrorLog( "Bad event: track \"" + std::get<std::string>( target ) + "\" referenced in event \"" + asName + "\" doesn't exist" );
+//                ErrorLog( "Bad event: track \"" + std::get<symbol>( target ).str() + "\" referenced in event \"" + asName + "\" doesn't exist" );
                 flags &= ~( flags::track_busy | flags::track_free ); // zerowanie flag
             }
         }
@@ -327,7 +327,7 @@ basic_event::deserialize_targets( std::string const &Input ) {
     while( false == ( target = targetparser.getToken<std::string>( true, "|," ) ).empty() ) {
         // actual bindings to targets of proper type are created during scenario initialization
         if( target != "none" ) {
-            m_targets.emplace_back( target, nullptr );
+            m_targets.emplace_back( symbol( target ), nullptr );
         }
     }
 }
@@ -359,7 +359,7 @@ basic_event::export_as_text( std::ostream &Output ) const {
         for( auto &target : m_targets ) {
             auto *targetnode { std::get<scene::basic_node *>( target ) };
             Output
-                << ( targetnode != nullptr ? targetnode->name() : std::get<std::string>( target ) )
+                << ( targetnode != nullptr ? targetnode->name() : std::get<symbol>( target ).str() )
                 << ( ++targetidx < m_targets.size() ? '|' : ' ' );
         }
     }
@@ -873,10 +873,10 @@ copyvalues_event::init() {
     // skopiowanie komórki do innej
     init_targets( simulation::Memory, "memory cell" );
     // source cell
-    std::get<scene::basic_node *>( m_input.data_source ) = simulation::Memory.find( std::get<std::string>( m_input.data_source ) );
+    std::get<scene::basic_node *>( m_input.data_source ) = simulation::Memory.find( std::get<symbol>( m_input.data_source ).str() );
     if( std::get<scene::basic_node *>( m_input.data_source ) == nullptr ) {
         m_ignored = true; // deaktywacja
-        ErrorLog( "Bad event: \"" + m_name + "\" (type: " + type() + ") can't find memory cell \"" + std::get<std::string>( m_input.data_source ) + "\"" );
+        ErrorLog( "Bad event: \"" + m_name + "\" (type: " + type() + ") can't find memory cell \"" + std::get<symbol>( m_input.data_source ).str() + "\"" );
     }
 }
 
@@ -903,7 +903,7 @@ copyvalues_event::deserialize_( cParser &Input, scene::scratch_data &Scratchpad
         Input >> token;
         switch( ++paramidx ) {
             case 1: { // nazwa drugiej komórki (źródłowej) // previously stored in param 9
-                std::get<std::string>( m_input.data_source ) = token;
+                std::get<symbol>( m_input.data_source ) = symbol( token );
                 break;
             }
             case 2: { // maska wartości
@@ -964,7 +964,7 @@ copyvalues_event::export_as_text_( std::ostream &Output ) const {
     Output
         << ( datasource != nullptr ?
                 datasource->name() :
-                std::get<std::string>( m_input.data_source ) )
+                std::get<symbol>( m_input.data_source ).str() )
         << ' ' << ( m_input.flags & ( flags::text | flags::value1 | flags::value2 ) ) << ' ';
 }
 
@@ -1221,9 +1221,9 @@ multi_event::init() {
     m_conditions.init();
     // child events bindings
     for( auto &childevent : m_children ) {
-        std::get<basic_event *>( childevent ) = simulation::Events.FindEvent( std::get<std::string>( childevent ) );
+        std::get<basic_event *>( childevent ) = simulation::Events.FindEvent( std::get<symbol>( childevent ).str() );
         if( std::get<basic_event *>( childevent ) == nullptr ) {
-            ErrorLog( "Bad event: \"" + m_name + "\" (type: " + type() + ") can't find event \"" + std::get<std::string>( childevent ) + "\"" );
+            ErrorLog( "Bad event: \"" + m_name + "\" (type: " + type() + ") can't find event \"" + std::get<symbol>( childevent ).str() + "\"" );
         }
     }
 }
@@ -1231,7 +1231,7 @@ multi_event::init() {
 std::vector<std::string> multi_event::dump_children_names() const {
     std::vector<std::string> result;
     for (auto const &childevent : m_children) {
-        result.push_back(std::get<std::string>(childevent));
+        result.push_back(std::get<symbol>(childevent).str());
     }
     return result;
 }
@@ -1270,7 +1270,7 @@ multi_event::deserialize_( cParser &Input, scene::scratch_data &Scratchpad ) {
                 WriteLog( "Multi-event \"" + m_name + "\" ignored link to event \"" + token + "\"" );
             }
             else {
-                m_children.emplace_back( token, nullptr, m_conditions.has_else == false );
+                m_children.emplace_back( symbol( token ), nullptr, m_conditions.has_else == false );
             }
         }
     }
@@ -1326,7 +1326,7 @@ multi_event::export_as_text_( std::ostream &Output ) const {
             Output
                 << ( childeventdata != nullptr ?
                     childeventdata->m_name :
-                    std::get<std::string>( childevent ) )
+                    std::get<symbol>( childevent ).str() )
                 << ' ';
         }
     }
@@ -1339,7 +1339,7 @@ multi_event::export_as_text_( std::ostream &Output ) const {
                 Output
                     << ( childeventdata != nullptr ?
                         childeventdata->m_name :
-                        std::get<std::string>( childevent ) )
+                        std::get<symbol>( childevent ).str() )
                     << ' ';
             }
         }
@@ -1355,10 +1355,10 @@ void
 sound_event::init() {
     // odtworzenie dźwięku
     for( auto &target : m_sounds ) {
-        std::get<sound_source *>( target ) = simulation::Sounds.find( std::get<std::string>( target ) );
+        std::get<sound_source *>( target ) = simulation::Sounds.find( std::get<symbol>( target ).str() );
         if( std::get<sound_source *>( target ) == nullptr ) {
             m_ignored = true; // deaktywacja
-            ErrorLog( "Bad event: \"" + m_name + "\" (type: " + type() + ") can't find static sound \"" + std::get<std::string>( target ) + "\"" );
+            ErrorLog( "Bad event: \"" + m_name + "\" (type: " + type() + ") can't find static sound \"" + std::get<symbol>( target ).str() + "\"" );
         }
     }
 }
@@ -1445,7 +1445,7 @@ sound_event::deserialize_targets( std::string const &Input ) {
     while( false == ( target = targetparser.getToken<std::string>( true, "|," ) ).empty() ) {
         // actual bindings to targets of proper type are created during scenario initialization
         if( target != "none" ) {
-            m_sounds.emplace_back( target, nullptr );
+            m_sounds.emplace_back( symbol( target ), nullptr );
         }
     }
 }
@@ -1472,7 +1472,7 @@ texture_event::init() {
     init_targets( simulation::Instances, "model instance" );
     // optional input data memory cell
     TMemCell *inputcell { nullptr };
-    auto const inputcellname { std::get<std::string>( m_input.data_source ) };
+    auto const &inputcellname { std::get<symbol>( m_input.data_source ).str() };
     if( inputcellname != "none" ) {
         inputcell = simulation::Memory.find( inputcellname );
         if( inputcell == nullptr ) {
@@ -1494,10 +1494,12 @@ void
 texture_event::deserialize_( cParser &Input, scene::scratch_data &Scratchpad ) {
 
     Input.getTokens( 3 );
+    std::string inputcellname;
     Input
         >> m_skinindex
         >> m_skin
-        >> std::get<std::string>( m_input.data_source );
+        >> inputcellname;
+    std::get<symbol>( m_input.data_source ) = symbol( inputcellname );
 
     // validate input
     if( m_skinindex < 0 ) {
@@ -1546,7 +1548,7 @@ texture_event::export_as_text_( std::ostream &Output ) const {
     Output
         << m_skinindex << ' '
         << m_skin << ' '
-        << std::get<std::string>( m_input.data_source ) << ' ';
+        << std::get<symbol>( m_input.data_source ).str() << ' ';
 }
 
 
@@ -2012,7 +2014,7 @@ visible_event::init() {
     // ukrycie albo przywrócenie obiektu
     for( auto &target : m_targets ) {
         auto &targetnode{ std::get<scene::basic_node *>( target ) };
-        auto &targetname{ std::get<std::string>( target ) };
+        auto const &targetname{ std::get<symbol>( target ).str() };
         // najpierw model
         targetnode = simulation::Instances.find( targetname );
         if( targetnode == nullptr ) {
@@ -2025,7 +2027,7 @@ visible_event::init() {
         }
         if( targetnode == nullptr ) {
             m_ignored = true; // deaktywacja
-            ErrorLog( "Bad event: \"" + m_name + "\" (type: " + type() + ") can't find item \"" + std::get<std::string>( target ) + "\"" );
+            ErrorLog( "Bad event: \"" + m_name + "\" (type: " + type() + ") can't find item \"" + std::get<symbol>( target ).str() + "\"" );
         }
     }
 }
@@ -2267,6 +2269,8 @@ event_manager::queue_receivers( radio_message const Message, glm::dvec3 const &L
 void
 event_manager::update() {
 
+    PROFILE_ZONE( "events" );
+
     // process currently queued events
     CheckQuery();
     // test list of global events for possible new additions to the queue
@@ -2292,8 +2296,8 @@ event_manager::update() {
 bool
 event_manager::insert( basic_event *Event ) {
     // najpierw sprawdzamy, czy nie ma, a potem dopisujemy
-    auto lookup = m_eventmap.find( Event->m_name );
-    if( lookup != m_eventmap.end() ) {
+    auto const lookup = m_eventmap.find( Event->m_name );
+    if( lookup != name_index::npos ) {
         // duplicate of already existing event
         auto const size = Event->m_name.size();
         // zawsze jeden znak co najmniej jest
@@ -2316,7 +2320,7 @@ event_manager::insert( basic_event *Event ) {
             return false;
         }
 
-        auto *duplicate = m_events[ lookup->second ];
+        auto *duplicate = m_events[ lookup ];
         if( Global.bJoinEvents ) {
             // doczepka (taki wirtualny multiple bez warunków)
             duplicate->append( Event );
@@ -2331,9 +2335,9 @@ event_manager::insert( basic_event *Event ) {
     }
 
     m_events.emplace_back( Event );
-    if( lookup == m_eventmap.end() ) {
+    if( lookup == name_index::npos ) {
         // if it's first event with such name, it's potential candidate for the execution queue
-        m_eventmap.emplace( Event->m_name, m_events.size() - 1 );
+        m_eventmap.insert( Event->m_name, m_events.size() - 1 );
         if( Event->m_ignored != true
          && contains(Event->m_name, "onstart") ) {
             // event uruchamiany automatycznie po starcie
@@ -2362,7 +2366,7 @@ uint32_t event_manager::GetEventId(const std::string &Name)
 		return -1;
 
 	auto const lookup = m_eventmap.find(Name);
-	return lookup != m_eventmap.end() ? lookup->second : -1;
+	return lookup != name_index::npos ? lookup : -1;
 }
 
 // legacy method, returns pointer to specified event, or null
@@ -2537,6 +2541,15 @@ event_manager::InitLaunchers() {
     }
 }
 
+// compacts name lookups of events and launchers, once the scenario is loaded
+void
+event_manager::freeze() {
+
+    m_eventmap.freeze();
+    m_inputdrivenlaunchers.freeze();
+    m_radiodrivenlaunchers.freeze();
+}
+
 // sends basic content of the class in legacy (text) format to provided stream
 void
 event_manager::export_as_text( std::ostream &Output ) const {
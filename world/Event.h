@@ -101,7 +101,7 @@ public:
 
 protected:
 // types
-    using basic_node = std::tuple<std::string, scene::basic_node *>;
+    using basic_node = std::tuple<symbol, scene::basic_node *>;
     using node_sequence = std::vector<basic_node>;
 
     struct event_conditions {
@@ -166,7 +166,7 @@ protected:
         std::string data_text;
         double data_value_1 { 0.0 };
         double data_value_2 { 0.0 };
-        basic_node data_source { "", nullptr };
+        basic_node data_source { symbol(), nullptr };
         glm::dvec3 location { 0.0 };
         TCommandType command_type { TCommandType::cm_Unknown };
 
@@ -338,7 +338,7 @@ public:
 private:
 // types
     // wrapper for binding between editor-supplied name, event, and execution conditional flag
-    using conditional_event = std::tuple<std::string, basic_event *, bool>;
+    using conditional_event = std::tuple<symbol, basic_event *, bool>;
 // methods
     // event type string
     std::string type() const override;
@@ -365,7 +365,7 @@ public:
 private:
 // types
     // wrapper for binding between editor-supplied name and sound object
-    using basic_sound = std::tuple<std::string, sound_source *>;
+    using basic_sound = std::tuple<symbol, sound_source *>;
 // methods
     // event type string
     std::string type() const override;
@@ -397,7 +397,7 @@ public:
 private:
 // types
     struct input_data {
-        basic_node data_source { "", nullptr };
+        basic_node data_source { symbol(), nullptr };
 
         TMemCell const * data_cell() const;
         TMemCell * data_cell();
@@ -693,6 +693,9 @@ public:
     // legacy method, initializes event launchers after deserialization from scenario file
     void
         InitLaunchers();
+    // compacts name lookups of events and launchers, once the scenario is loaded
+    void
+        freeze();
     // sends basic content of the class in legacy (text) format to provided stream
     void
         export_as_text( std::ostream &Output ) const;
@@ -703,7 +706,7 @@ public:
 private:
 // types
     using event_sequence = std::deque<basic_event *>;
-    using event_map = std::unordered_map<std::string, std::size_t>;
+    using event_map = name_index;
     using eventlauncher_sequence = std::vector<TEventLauncher *>;
 // members
     event_sequence m_events;
@@ -740,11 +743,11 @@ void
 basic_event::init_targets( TableType_ &Repository, std::string const &Targettype, bool const Logerrors ) {
 
     for( auto &target : m_targets ) {
-        std::get<scene::basic_node *>( target ) = Repository.find( std::get<std::string>( target ) );
+        std::get<scene::basic_node *>( target ) = Repository.find( std::get<symbol>( target ).str() );
         if( std::get<scene::basic_node *>( target ) == nullptr ) {
             m_ignored = true; // deaktywacja
             if( Logerrors )
-                ErrorLog( "Bad event: \"" + m_name + "\" (type: " + type() + ") can't find " + Targettype +" \"" + std::get<std::string>( target ) + "\"" );
+                ErrorLog( "Bad event: \"" + m_name + "\" (type: " + type() + ") can't find " + Targettype +" \"" + std::get<symbol>( target ).str() + "\"" );
         }
     }
 }
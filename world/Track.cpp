@@ -807,37 +807,37 @@ void TTrack::Load(cParser *parser, glm::dvec3 const &pOrigin)
         {
             parser->getTokens();
             *parser >> token;
-            m_events0.emplace_back( token, nullptr );
+            m_events0.emplace_back( symbol( token ), nullptr );
         }
         else if (str == "event1")
         {
             parser->getTokens();
             *parser >> token;
-            m_events1.emplace_back( token, nullptr );
+            m_events1.emplace_back( symbol( token ), nullptr );
         }
         else if (str == "event2")
         {
             parser->getTokens();
             *parser >> token;
-            m_events2.emplace_back( token, nullptr );
+            m_events2.emplace_back( symbol( token ), nullptr );
         }
         else if (str == "eventall0")
         {
             parser->getTokens();
             *parser >> token;
-            m_events0all.emplace_back( token, nullptr );
+            m_events0all.emplace_back( symbol( token ), nullptr );
         }
         else if (str == "eventall1")
         {
             parser->getTokens();
             *parser >> token;
-            m_events1all.emplace_back( token, nullptr );
+            m_events1all.emplace_back( symbol( token ), nullptr );
         }
         else if (str == "eventall2")
         {
             parser->getTokens();
             *parser >> token;
-            m_events2all.emplace_back( token, nullptr );
+            m_events2all.emplace_back( symbol( token ), nullptr );
         }
         else if (str == "velocity")
         {
@@ -980,12 +980,12 @@ bool TTrack::AssignEvents() {
 
     for( auto &eventsequence : eventsequences ) {
         for( auto &event : *eventsequence.second ) {
-            event.second = simulation::Events.FindEvent( event.first );
+            event.second = simulation::Events.FindEvent( event.first.str() );
             if( event.second != nullptr ) {
                 m_events = true;
             }
             else {
-                ErrorLog( "Bad track: " + ( m_name.empty() ? "unnamed track" : "\"" + m_name + "\"" ) + " can't find assigned event \"" + event.first + "\"" );
+                ErrorLog( "Bad track: " + ( m_name.empty() ? "unnamed track" : "\"" + m_name + "\"" ) + " can't find assigned event \"" + event.first.str() + "\"" );
                 lookupfail = true;
             }
         }
@@ -1000,7 +1000,7 @@ bool TTrack::AssignEvents() {
             auto *event = simulation::Events.FindEvent( trackname + ':' + eventsequence.first );
             if( event != nullptr ) {
                 // HACK: auto-associated events come with empty lookup string, to avoid including them in the text format export
-                eventsequence.second->emplace_back( "", event );
+                eventsequence.second->emplace_back( symbol(), event );
                 m_events = true;
             }
         }
@@ -2355,7 +2355,7 @@ TTrack::export_as_text_( std::ostream &Output ) const {
                 << eventsequence.first << ' '
                 << ( event.second != nullptr ?
                         event.second->m_name :
-                        event.first )
+                        event.first.str() )
                 << ' ';
         }
     }
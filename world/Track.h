@@ -207,9 +207,10 @@ public:
 
 public:
     using dynamics_sequence = std::deque<TDynamicObject *>;
-    using event_sequence = std::vector<std::pair<std::string, basic_event *> >;
+    using event_sequence = std::vector<std::pair<symbol, basic_event *> >;
 
     dynamics_sequence Dynamics;
+    std::vector<TTraction *> m_traction; // traction pieces within reach of pantographs of vehicles on the path
     event_sequence
         m_events0all,
         m_events1all,
@@ -16,6 +16,8 @@ http://mozilla.org/MPL/2.0/.
 #include "world/Traction.h"
 
 #include "simulation/simulation.h"
+#include "scene/quadtree.h"
+#include "world/Track.h"
 #include "utilities/Globals.h"
 #include "world/TractionPower.h"
 #include "utilities/Logs.h"
@@ -885,3 +887,73 @@ traction_table::InitTraction() {
         }
     } while( true == connected );
 }
+
+// assigns traction pieces to paths running below them, for quick pantograph contact lookups
+void
+traction_table::associate_paths() {
+
+    // horizontal distance from the path centreline within which pantographs of vehicles on the path can reach the wire.
+    // covers pantograph offset on canted or curved path, pantograph width with guide horns and pantographs overhanging path ends
+    auto const reach { 5.0 };
+    // spacing of points sampled along the paths. the path parametrization isn't uniform, so the full spacing is added to the reach
+    auto const samplespacing { 5.0 };
+    auto const range { reach + samplespacing };
+
+    scene::basic_quadtree<TTraction *> wires;
+    for( auto *traction : m_items ) {
+        if( traction == nullptr ) { continue; }
+        auto const wirelength { glm::length( glm::dvec2{ traction->pPoint2.x - traction->pPoint1.x, traction->pPoint2.z - traction->pPoint1.z } ) };
+        wires.insert( traction, 0.5 * ( traction->pPoint1 + traction->pPoint2 ), static_cast<float>( 0.5 * wirelength ) );
+    }
+    wires.build();
+    // horizontal distance between specified point and the wire
+    auto const wiredistance = []( glm::dvec3 const &Point, TTraction const *Traction ) {
+        glm::dvec2 const start { Traction->pPoint1.x, Traction->pPoint1.z };
+        glm::dvec2 const span { glm::dvec2{ Traction->pPoint2.x, Traction->pPoint2.z } - start };
+        glm::dvec2 const point { Point.x, Point.z };
+        auto const spanlength2 { glm::dot( span, span ) };
+        auto const t { (
+            spanlength2 > 0.0 ?
+                std::clamp( glm::dot( point - start, span ) / spanlength2, 0.0, 1.0 ) :
+                0.0 ) };
+        return glm::length( point - ( start + t * span ) ); };
+
+    std::vector<TSegment const *> segments;
+    for( auto *path : simulation::Paths.sequence() ) {
+        if( path == nullptr ) { continue; }
+        path->m_traction.clear();
+        if( ( ( path->iCategoryFlag & 1 ) == 0 )
+         || ( path->eType == tt_Table ) ) {
+            // only rail vehicles use pantographs, and turntables move their paths around
+            continue;
+        }
+        // switches and crossings hold geometry of their paths in separate segments
+        segments.clear();
+        if( path->SwitchExtension ) {
+            for( auto const &segment : path->SwitchExtension->Segments ) {
+                if( segment ) {
+                    segments.emplace_back( segment.get() );
+                }
+            }
+        }
+        else if( path->Segment ) {
+            segments.emplace_back( path->Segment.get() );
+        }
+        for( auto const *segment : segments ) {
+            auto const samplecount { std::max( 1, static_cast<int>( std::ceil( segment->GetLength() / samplespacing ) ) ) };
+            for( auto sample = 0; sample <= samplecount; ++sample ) {
+                auto const point { segment->FastGetPoint( static_cast<double>( sample ) / samplecount ) };
+                wires.query(
+                    point, static_cast<float>( range ),
+                    [&]( TTraction *Traction ) {
+                        if( wiredistance( point, Traction ) <= range ) {
+                            path->m_traction.emplace_back( Traction ); } } );
+            }
+        }
+        std::sort( std::begin( path->m_traction ), std::end( path->m_traction ) );
+        path->m_traction.erase(
+            std::unique( std::begin( path->m_traction ), std::end( path->m_traction ) ),
+            std::end( path->m_traction ) );
+        path->m_traction.shrink_to_fit();
+    }
+}
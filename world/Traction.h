@@ -97,6 +97,9 @@ public:
     // legacy method, initializes traction after deserialization from scenario file
     void
         InitTraction();
+    // assigns traction pieces to paths running below them, for quick pantograph contact lookups. requires linked paths
+    void
+        associate_paths();
 };
 
 //---------------------------------------------------------------------------
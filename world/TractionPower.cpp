@@ -111,12 +111,20 @@ bool TTractionPowerSource::Update(double dt)
     if (TotalPreviousAdmitance == 0.0)
         TotalPreviousAdmitance = 1e-10; // przynajmniej minimalna upływność
     TotalAdmitance = 1e-10; // a w aktualnym kroku sumujemy admitancję
+    // without load and fuse activity subsequent updates wouldn't change anything, until some vehicle draws current again
+    m_active = ( m_loaded || FastFuse || SlowFuse );
+    m_loaded = false;
     return true;
 };
 
 double TTractionPowerSource::CurrentGet(double res)
 { // pobranie wartości prądu przypadającego na rezystancję (res)
     // niech pamięta poprzednią admitancję i wg niej przydziela prąd
+    m_loaded = true;
+    if( ( false == m_active )
+     && ( m_grid != nullptr ) ) {
+        m_grid->activate( this );
+    }
     if (SlowFuse || FastFuse)
     { // czekanie na zanik obciążenia sekcji
         if (res < 100.0) // liczenie czasu dopiero, gdy obciążenie zniknie
@@ -195,9 +203,31 @@ TTractionPowerSource::export_as_text_( std::ostream &Output ) const {
 void
 powergridsource_table::update( double const Deltatime ) {
 
-    for( auto *powersource : m_items ) {
-        powersource->Update( Deltatime );
+    // sources added since the last update start active
+    for( ; m_itemcount < m_items.size(); ++m_itemcount ) {
+        auto *powersource { m_items[ m_itemcount ] };
+        if( powersource == nullptr ) { continue; }
+        powersource->m_grid = this;
+        powersource->m_active = true;
+        m_activeitems.emplace_back( powersource );
     }
+    // idle sources drop out of the list, to be brought back by vehicles drawing current from them
+    m_activeitems.erase(
+        std::remove_if(
+            std::begin( m_activeitems ), std::end( m_activeitems ),
+            [&]( TTractionPowerSource *Source ) {
+                Source->Update( Deltatime );
+                return ( false == Source->m_active ); } ),
+        std::end( m_activeitems ) );
+}
+
+void
+powergridsource_table::activate( TTractionPowerSource *Source ) {
+
+    if( true == Source->m_active ) { return; }
+
+    Source->m_active = true;
+    m_activeitems.emplace_back( Source );
 }
 
 //---------------------------------------------------------------------------
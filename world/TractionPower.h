@@ -16,6 +16,7 @@ http://mozilla.org/MPL/2.0/.
 class TTractionPowerSource : public scene::basic_node {
 
     friend class debug_panel;
+    friend class powergridsource_table;
 
 public:
 // constructor
@@ -62,6 +63,10 @@ private:
     bool SlowFuse = false;
     double FuseTimer = 0.0;
     int FuseCounter = 0;
+    // activity tracking. sources without load and with no fuse activity are left out of the grid updates
+    bool m_active { true };
+    bool m_loaded { false }; // load was registered since the last update
+    powergridsource_table *m_grid { nullptr }; // grid responsible for updates of the source
 
 };
 
@@ -74,6 +79,14 @@ public:
     // legacy method, calculates changes in simulation state over specified time
     void
         update( double const Deltatime );
+    // puts provided source back on the list of updated sources
+    void
+        activate( TTractionPowerSource *Source );
+
+private:
+// members
+    std::vector<TTractionPowerSource *> m_activeitems; // sources with load or running fuse timer
+    std::size_t m_itemcount { 0 }; // number of table items already handed to the activity tracking
 };
 
 //---------------------------------------------------------------------------